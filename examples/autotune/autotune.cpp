@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "../include/utils.hpp"
+#include <CLI/CLI.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <sycl/sycl.hpp>
+#include <sygraph/sygraph.hpp>
+#include <vector>
+
+struct CalibrationOptions {
+  size_t num_sources = 4;
+  size_t repetitions = 3;
+  std::vector<float> alphas{1, 5, 10, 15, 20, 25, 30, 35, 40};
+  std::vector<float> betas{1, 10, 100, 1000, 10000, 100000, 1000000};
+  std::vector<size_t> workitem_max_degrees{4, 8, 16, 32, 64};
+  std::vector<size_t> bucketing_min_degrees{64, 128, 256, 512, 1024, 4096};
+  std::string output = "sygraph-tuning.json";
+};
+
+// Returns the best time over the repetitions, summed over the sources, of a BFS run with the active tuning profile.
+template<typename GraphT>
+double timeBFS(GraphT& G,
+               const std::vector<unsigned int>& sources,
+               size_t repetitions,
+               sygraph::algorithms::bfs_direction direction,
+               float alpha = 1.0f,
+               float beta = 1.0f) {
+  // the frontiers take the bitmap width of the device profile when the instance is built
+  sygraph::algorithms::BFS bfs{G};
+  double total = 0;
+  for (auto source : sources) {
+    double best = std::numeric_limits<double>::max();
+    for (size_t r = 0; r < repetitions; r++) {
+      bfs.init(source);
+      auto start = std::chrono::high_resolution_clock::now();
+      bfs.run(direction, alpha, beta);
+      auto end = std::chrono::high_resolution_clock::now();
+      best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    total += best;
+  }
+  return total;
+}
+
+void applyProfile(sycl::queue& q, const sygraph::tuning::TuningProfile& profile) {
+  sygraph::tuning::setProfile(profile);
+  sygraph::device::resetProfile(q);
+}
+
+int main(int argc, char** argv) {
+  using type_t = unsigned int;
+  GraphOptions opts;
+  CalibrationOptions calibration;
+  CLI::App app{"SYgraph autotuner"};
+  auto* source_option = configureBaseCLI(app, opts);
+  app.add_option("--sources", calibration.num_sources, "Number of random sources of each calibration run")->check(CLI::PositiveNumber);
+  app.add_option("--repetitions", calibration.repetitions, "Repetitions of each calibration run")->check(CLI::PositiveNumber);
+  app.add_option("--alphas", calibration.alphas, "Alpha values tried for the hybrid BFS")->check(CLI::PositiveNumber);
+  app.add_option("--betas", calibration.betas, "Beta values tried for the hybrid BFS")->check(CLI::PositiveNumber);
+  app.add_option("--workitem-degrees", calibration.workitem_max_degrees, "Work-item degree thresholds tried for the automatic load balancer")
+      ->check(CLI::PositiveNumber);
+  app.add_option("--bucketing-degrees", calibration.bucketing_min_degrees, "Bucketing degree thresholds tried for the automatic load balancer")
+      ->check(CLI::PositiveNumber);
+  app.add_option("-o,--output", calibration.output, "Path of the tuning profile to write");
+  CLI11_PARSE(app, argc, argv);
+  finalizeGraphOptions(opts, source_option);
+
+  std::cerr << "[*] Reading CSR" << std::endl;
+  sygraph::graph::Properties properties;
+  auto csr = readCSR<float, type_t, type_t>(opts, &properties);
+
+  sycl::queue q{sycl::gpu_selector_v};
+  printDeviceInfo(q, "[*] ");
+
+  std::cerr << "[*] Building Graph" << std::endl;
+  auto G = sygraph::graph::build::fromCSR<graph_location>(q, csr, properties);
+  printGraphInfo(G);
+
+  std::vector<type_t> sources;
+  if (opts.random_source) {
+    for (size_t i = 0; i < calibration.num_sources; i++) { sources.push_back(static_cast<type_t>(getRandomSource(G.getVertexCount()))); }
+  } else {
+    sources.push_back(static_cast<type_t>(opts.source));
+  }
+
+  // the sweep starts from the values of the device, ignoring any previously loaded profile
+  sygraph::tuning::resetProfile();
+  sygraph::device::resetProfile(q);
+  const auto& device_profile = sygraph::device::getProfile(q);
+
+  sygraph::tuning::TuningProfile best;
+  best.device = q.get_device().get_info<sycl::info::device::name>();
+  double best_time = std::numeric_limits<double>::max();
+
+  std::cerr << "[*] Calibrating load balancer, work-group size and bitmap width" << std::endl;
+  for (auto lb : {sygraph::operators::load_balancer::workgroup_mapped,
+                  sygraph::operators::load_balancer::bucketing,
+                  sygraph::operators::load_balancer::automatic}) {
+    for (size_t compute_unit_size : {64, 128, 256, 512, 1024}) {
+      if (compute_unit_size > device_profile.max_work_group_size) { continue; }
+      for (size_t bitmap_width : {32, 64}) {
+        auto candidate = best;
+        candidate.load_balancer = lb;
+        candidate.compute_unit_size = compute_unit_size;
+        candidate.bitmap_width = bitmap_width;
+        applyProfile(q, candidate);
+
+        double time = timeBFS(G, sources, calibration.repetitions, sygraph::algorithms::bfs_direction::push);
+        std::cerr << "    " << sygraph::tuning::toString(lb) << ", work-group " << compute_unit_size << ", bitmap " << bitmap_width << ": " << time
+                  << " ms" << std::endl;
+        if (time < best_time) {
+          best_time = time;
+          best = candidate;
+        }
+      }
+    }
+  }
+
+  if (best.load_balancer == sygraph::operators::load_balancer::automatic) {
+    std::cerr << "[*] Calibrating automatic load balancer thresholds" << std::endl;
+    auto tuned = best;
+    for (size_t workitem_max_degree : calibration.workitem_max_degrees) {
+      for (size_t bucketing_min_degree : calibration.bucketing_min_degrees) {
+        if (bucketing_min_degree <= workitem_max_degree) { continue; }
+        auto candidate = tuned;
+        candidate.workitem_max_degree = workitem_max_degree;
+        candidate.bucketing_min_degree = bucketing_min_degree;
+        applyProfile(q, candidate);
+
+        double time = timeBFS(G, sources, calibration.repetitions, sygraph::algorithms::bfs_direction::push);
+        std::cerr << "    work-items up to degree " << workitem_max_degree << ", bucketing from degree " << bucketing_min_degree << ": " << time
+                  << " ms" << std::endl;
+        if (time < best_time) {
+          best_time = time;
+          best = candidate;
+        }
+      }
+    }
+  }
+
+  std::cerr << "[*] Calibrating hybrid BFS alpha/beta" << std::endl;
+  applyProfile(q, best);
+  best_time = std::numeric_limits<double>::max();
+  for (float alpha : calibration.alphas) {
+    for (float beta : calibration.betas) {
+      double time = timeBFS(G, sources, calibration.repetitions, sygraph::algorithms::bfs_direction::hybrid, alpha, beta);
+      std::cerr << "    alpha " << alpha << ", beta " << beta << ": " << time << " ms" << std::endl;
+      if (time < best_time) {
+        best_time = time;
+        best.bfs_alpha = alpha;
+        best.bfs_beta = beta;
+      }
+    }
+  }
+
+  sygraph::tuning::save(best, calibration.output);
+  std::cout << sygraph::tuning::toJSON(best);
+  std::cerr << "[!] Tuning profile written to " << calibration.output << std::endl;
+  return 0;
+}
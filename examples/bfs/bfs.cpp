@@ -60,6 +60,7 @@ std::string directionToString(sygraph::algorithms::bfs_direction direction) {
     case sygraph::algorithms::bfs_direction::push: return "push";
     case sygraph::algorithms::bfs_direction::pull: return "pull";
     case sygraph::algorithms::bfs_direction::hybrid: return "hybrid";
+    case sygraph::algorithms::bfs_direction::persistent: return "persistent";
     default: return "push";
   }
 }
@@ -68,6 +69,7 @@ sygraph::algorithms::bfs_direction parseAdvanceDirection(std::string value) {
   std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
   if (value == "pull") { return sygraph::algorithms::bfs_direction::pull; }
   if (value == "hybrid") { return sygraph::algorithms::bfs_direction::hybrid; }
+  if (value == "persistent") { return sygraph::algorithms::bfs_direction::persistent; }
   return sygraph::algorithms::bfs_direction::push;
 }
 
@@ -104,11 +106,18 @@ int main(int argc, char** argv) {
   std::string advance_mode = "push";
   float alpha = 15.0f;
   float beta = 24.0f;
+  bool in_order = false;
+  size_t convergence_period = 1;
+  bool command_graph = false;
 
-  app.add_option("--advance", advance_mode, "Select BFS advance strategy (push|pull|hybrid)")
-      ->check(CLI::IsMember({"push", "pull", "hybrid"}, CLI::ignore_case));
+  app.add_option("--advance", advance_mode, "Select BFS advance strategy (push|pull|hybrid|persistent)")
+      ->check(CLI::IsMember({"push", "pull", "hybrid", "persistent"}, CLI::ignore_case));
   app.add_option("--alpha", alpha, "Alpha parameter for hybrid BFS")->check(CLI::PositiveNumber);
   app.add_option("--beta", beta, "Beta parameter for hybrid BFS")->check(CLI::PositiveNumber);
+  app.add_flag("--in-order", in_order, "Run on an in-order queue, which lets iterations run ahead of the host");
+  app.add_option("--convergence-period", convergence_period, "Iterations between two convergence checks on in-order queues")
+      ->check(CLI::PositiveNumber);
+  app.add_flag("--command-graph", command_graph, "Replay iterations from SYCL command graphs on in-order queues");
   CLI11_PARSE(app, argc, argv);
   finalizeGraphOptions(opts, source_option);
   auto advance_direction = parseAdvanceDirection(advance_mode);
@@ -118,10 +127,17 @@ int main(int argc, char** argv) {
   auto csr = readCSR<float, type_t, type_t>(opts, &properties);
 
 #ifdef ENABLE_PROFILING
-  sycl::queue q{sycl::gpu_selector_v, sycl::property::queue::enable_profiling()};
+  sycl::property_list queue_properties = in_order ? sycl::property_list{sycl::property::queue::enable_profiling(), sycl::property::queue::in_order()}
+                                                  : sycl::property_list{sycl::property::queue::enable_profiling()};
 #else
-  sycl::queue q{sycl::gpu_selector_v};
+  sycl::property_list queue_properties = in_order ? sycl::property_list{sycl::property::queue::in_order()} : sycl::property_list{};
 #endif
+  sycl::queue q{sycl::gpu_selector_v, queue_properties};
+
+  auto tuning = sygraph::tuning::getProfile();
+  tuning.convergence_period = convergence_period;
+  tuning.command_graph = command_graph;
+  sygraph::tuning::setProfile(tuning);
 
   printDeviceInfo(q, "[*] ");
 
@@ -11,11 +11,13 @@
 #include <sygraph/operators/advance/advance.hpp>
 #include <sygraph/operators/for/for.hpp>
 #include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/tuning.hpp>
 
 #ifdef ENABLE_PROFILING
 #include <sygraph/utils/profiler.hpp>
 #endif
 #include <memory>
+#include <optional>
 
 namespace sygraph {
 namespace algorithms {
@@ -26,6 +28,7 @@ struct BCInstance {
   using vertex_t = typename GraphType::vertex_t;
   using edge_t = typename GraphType::edge_t;
   using weight_t = typename GraphType::weight_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
 
   const vertex_t invalid = std::numeric_limits<vertex_t>::max();
 
@@ -37,7 +40,14 @@ struct BCInstance {
   weight_t* sigmas;
   weight_t* bc_values;
 
-  BCInstance(GraphType& G, const vertex_t source) : G(G), source(source) {
+  frontiers_t frontiers; // input and output frontiers, with the device's bitmap word
+  bool dirty = false; // set while a run is in progress, the frontiers must be cleared if it did not complete
+  sycl::event ready;
+
+  // the forward sweep pulls sigmas from every parent in the frontier into the unvisited vertices
+  sygraph::operators::advance::DirectionOptimizer<sygraph::operators::direction::pull_all, sygraph::frontier::frontier_view::vertex, true> optimizer;
+
+  BCInstance(GraphType& G) : G(G), source(0), frontiers(G.getQueue(), G.getVertexCount()), optimizer(G) {
     sycl::queue& queue = G.getQueue();
     size_t size = G.getVertexCount();
 
@@ -45,16 +55,40 @@ struct BCInstance {
     deltas = sygraph::memory::detail::memoryAlloc<weight_t, memory::space::device>(size, queue);
     sigmas = sygraph::memory::detail::memoryAlloc<weight_t, memory::space::device>(size, queue);
     bc_values = sygraph::memory::detail::memoryAlloc<weight_t, memory::space::device>(size, queue);
+  }
 
-    queue.fill(labels, static_cast<vertex_t>(this->invalid), size);
-    queue.fill(deltas, static_cast<weight_t>(0), size);
-    queue.fill(sigmas, static_cast<weight_t>(0), size);
-    queue.fill(bc_values, static_cast<weight_t>(0), size);
-    queue.wait_and_throw();
+  /**
+   * @brief Initializes labels, deltas, sigmas, bc values and the input frontier for a new source with a single kernel.
+   */
+  void reset(const vertex_t source) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
 
-    queue.fill(&sigmas[source], static_cast<weight_t>(1), 1);
-    queue.fill(&labels[source], static_cast<vertex_t>(0), 1);
-    queue.wait_and_throw();
+    this->source = source;
+    auto invalid = this->invalid;
+    auto labels = this->labels;
+    auto deltas = this->deltas;
+    auto sigmas = this->sigmas;
+    auto bc_values = this->bc_values;
+    frontiers.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto in_dev_frontier = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          bool is_source = idx[0] == source;
+          labels[idx] = is_source ? static_cast<vertex_t>(0) : invalid;
+          deltas[idx] = static_cast<weight_t>(0);
+          sigmas[idx] = is_source ? static_cast<weight_t>(1) : static_cast<weight_t>(0);
+          bc_values[idx] = static_cast<weight_t>(0);
+          if (is_source) { in_dev_frontier.insert(source); }
+        });
+      });
+    });
   }
 
   ~BCInstance() {
@@ -88,21 +122,45 @@ public:
   /**
    * @brief Initializes the BCInstance with the given source vertex.
    *
-   * This function creates a new instance of BCInstance for the provided graph
-   * and source vertex, and assigns it to the internal _instance member.
+   * The BCInstance is created on the first call only; later calls reset its buffers
+   * and frontiers in place for the new source.
    *
    * @param source The source vertex from which to initialize the BCInstance.
    */
-  void init(const vertex_t source) { _instance = std::make_unique<detail::BCInstance<GraphType>>(_g, source); }
+  void init(const vertex_t source) {
+    if (!_instance) { _instance = std::make_unique<detail::BCInstance<GraphType>>(_g); }
+    _instance->reset(source);
+    _forward = true;
+    _backward = true;
+    _depth = 0;
+    _search_depth = 1;
+  }
 
   /**
    * @brief Resets the internal state of the instance.
    *
-   * This function calls the reset method on the internal instance,
-   * effectively resetting its state to the initial configuration.
+   * This function destroys the internal instance, releasing its buffers.
    */
   void reset() { _instance.reset(); }
 
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
+  /**
+   * @brief Sets the direction of the advances: `direction::push`, the default, or `direction::automatic`, which pulls
+   * the sigmas of the forward sweep into the unvisited vertices while the frontier is large.
+   *
+   * @throws std::runtime_error for the other directions.
+   */
+  void setDirection(sygraph::operators::direction direction) {
+    if (direction != sygraph::operators::direction::push && direction != sygraph::operators::direction::automatic) {
+      throw std::runtime_error("BC supports the push and automatic directions only");
+    }
+    _direction = direction;
+  }
+
   /**
    * @brief Executes the Betweenness Centrality (BC) algorithm.
    *
@@ -119,84 +177,93 @@ public:
     if (!_instance) { throw std::runtime_error("BC instance not initialized"); }
 
     auto& G = _instance->G;
-    sycl::queue& queue = G.getQueue();
-    size_t size = G.getVertexCount();
     auto source = _instance->source;
-
-    auto in_frontier = sygraph::frontier::makeFrontier<sygraph::frontier::frontier_view::vertex, sygraph::frontier::frontier_type::mlb>(queue, G);
-    auto out_frontier = sygraph::frontier::makeFrontier<sygraph::frontier::frontier_view::vertex, sygraph::frontier::frontier_type::mlb>(queue, G);
-
-    in_frontier.insert(source);
-
-    vertex_t invalid = _instance->invalid;
-    vertex_t* labels = _instance->labels;
-    weight_t* deltas = _instance->deltas;
-    weight_t* sigmas = _instance->sigmas;
-    weight_t* bc_values = _instance->bc_values;
-
-    using frontier_state_t = typename decltype(in_frontier)::frontier_state_type;
-    std::vector<frontier_state_t> frontiers_states;
-
-    while (!in_frontier.empty()) {
-      auto e = sygraph::operators::advance::frontier<sygraph::operators::load_balancer::workgroup_mapped,
-                                                     sygraph::frontier::frontier_view::vertex,
-                                                     sygraph::frontier::frontier_view::vertex>(
-          G, in_frontier, out_frontier, [=](auto src, auto dst, auto edge, auto weight) -> bool {
-            vertex_t new_label = labels[src] + 1;
-            vertex_t old_label = invalid;
-            sygraph::sync::cas(&labels[dst], old_label, new_label);
-
-            if (old_label != invalid && old_label != new_label) { return false; }
-
-            sygraph::sync::atomicFetchAdd(sigmas + dst, sigmas[src]);
-            return old_label == invalid;
-          });
-      e.wait_and_throw();
+    auto lb = _load_balancer.value_or(sygraph::tuning::getProfile().load_balancer);
+    _instance->frontiers.visit([&](auto& frontiers) {
+      auto& in_frontier = frontiers.in;
+      auto& out_frontier = frontiers.out;
+
+      _instance->ready.wait_and_throw();
+      _instance->dirty = true;
+
+      vertex_t invalid = _instance->invalid;
+      vertex_t* labels = _instance->labels;
+      weight_t* deltas = _instance->deltas;
+      weight_t* sigmas = _instance->sigmas;
+      weight_t* bc_values = _instance->bc_values;
+
+      using frontier_state_t = typename std::decay_t<decltype(in_frontier)>::frontier_state_type;
+      std::vector<frontier_state_t> frontiers_states;
+
+      using direction_t = sygraph::operators::direction;
+      using frontier_view_t = sygraph::frontier::frontier_view;
+
+      auto forward = [=](auto src, auto dst, auto edge, auto weight) -> bool {
+        vertex_t new_label = labels[src] + 1;
+        vertex_t old_label = invalid;
+        sygraph::sync::cas(&labels[dst], old_label, new_label);
+
+        if (old_label != invalid && old_label != new_label) { return false; }
+
+        sygraph::sync::atomicFetchAdd(sigmas + dst, sigmas[src]);
+        return old_label == invalid;
+      };
+      if (_direction == direction_t::automatic) { _instance->optimizer.reset(); }
+
+      while (!in_frontier.empty()) {
+        auto e = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<sygraph::operators::load_balancer Lb>() {
+          if (_direction == direction_t::automatic) {
+            return sygraph::operators::advance::frontier<direction_t::automatic, Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+                G, in_frontier, out_frontier, forward, _instance->optimizer);
+          }
+          return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(G, in_frontier, out_frontier, forward);
+        });
+        e.wait_and_throw();
 
 #ifdef ENABLE_PROFILING
-      sygraph::Profiler::addEvent(e, "BC::Forward");
+        sygraph::Profiler::addEvent(e, "BC::Forward");
 #endif
-      _depth++;
-      _search_depth++;
-
-      frontiers_states.push_back(out_frontier.saveState());
-      sygraph::frontier::swap(out_frontier, in_frontier);
-      out_frontier.clear();
-    }
-
-    while (_depth > 0) {
-      in_frontier.loadState(frontiers_states.back());
-      frontiers_states.pop_back();
-
-      auto e = sygraph::operators::advance::frontier<sygraph::operators::load_balancer::workgroup_mapped,
-                                                     sygraph::frontier::frontier_view::vertex,
-                                                     sygraph::frontier::frontier_view::none>(
-          G, in_frontier, out_frontier, [=](auto src, auto dst, auto edge, auto weight) -> bool {
-            if (src == source) { return false; }
-
-            auto s_label = labels[src];
-            auto d_label = labels[dst];
-            if (s_label + 1 != d_label) { return false; }
-
-            auto update = sigmas[src] / sigmas[dst] * (1 + deltas[dst]);
-            sygraph::sync::atomicFetchAdd(deltas + src, update);
-            sygraph::sync::atomicFetchAdd(bc_values + src, update);
-
-            return false;
-          });
-      e.wait_and_throw();
+        _depth++;
+        _search_depth++;
+
+        frontiers_states.push_back(out_frontier.saveState());
+        sygraph::frontier::swap(out_frontier, in_frontier);
+        out_frontier.clear();
+      }
+
+      while (_depth > 0) {
+        in_frontier.loadState(frontiers_states.back());
+        frontiers_states.pop_back();
+
+        auto e = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<sygraph::operators::load_balancer Lb>() {
+          return sygraph::operators::advance::frontier<Lb, sygraph::frontier::frontier_view::vertex, sygraph::frontier::frontier_view::none>(
+              G, in_frontier, out_frontier, [=](auto src, auto dst, auto edge, auto weight) -> bool {
+                if (src == source) { return false; }
+
+                auto s_label = labels[src];
+                auto d_label = labels[dst];
+                if (s_label + 1 != d_label) { return false; }
+
+                auto update = sigmas[src] / sigmas[dst] * (1 + deltas[dst]);
+                sygraph::sync::atomicFetchAdd(deltas + src, update);
+                sygraph::sync::atomicFetchAdd(bc_values + src, update);
+
+                return false;
+              });
+        });
+        e.wait_and_throw();
 #ifdef ENABLE_PROFILING
-      sygraph::Profiler::addEvent(e, "BC::Backward");
+        sygraph::Profiler::addEvent(e, "BC::Backward");
 #endif
-      _depth--;
-      _search_depth++;
-      if (isBackwardConverged()) { break; }
-    }
-
-    using load_balance_t = sygraph::operators::load_balancer;
-    using direction_t = sygraph::operators::direction;
-    using frontier_view_t = sygraph::frontier::frontier_view;
-    using frontier_impl_t = sygraph::frontier::frontier_type;
+        _depth--;
+        _search_depth++;
+        if (isBackwardConverged()) { break; }
+      }
+
+      // the backward sweep leaves the last restored state in the input frontier
+      in_frontier.clear();
+    });
+    _instance->dirty = false;
   }
 
 protected:
@@ -221,6 +288,8 @@ protected:
 private:
   GraphType& _g;
   std::unique_ptr<sygraph::algorithms::detail::BCInstance<GraphType>> _instance;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
+  sygraph::operators::direction _direction = sygraph::operators::direction::push;
 };
 
 } // namespace algorithms
@@ -7,14 +7,20 @@
 #include "sygraph/operators/config.hpp"
 #include <sycl/sycl.hpp>
 
+#include <sygraph/algorithms/bfs_persistent.hpp>
+#include <sygraph/frontier/convergence.hpp>
 #include <sygraph/frontier/frontier.hpp>
 #include <sygraph/graph/graph.hpp>
 #include <sygraph/operators/advance/advance.hpp>
 #include <sygraph/operators/for/for.hpp>
+#include <sygraph/sycl/command_graph.hpp>
+#include <sygraph/utils/tuning.hpp>
 #ifdef ENABLE_PROFILING
 #include <sygraph/utils/profiler.hpp>
 #endif
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <set>
 
 /**
@@ -26,7 +32,7 @@
 namespace sygraph {
 namespace algorithms {
 
-enum class bfs_direction { push, pull, hybrid };
+enum class bfs_direction { push, pull, hybrid, persistent };
 
 struct BFSRunDetails {
   size_t iterations = 0;
@@ -39,37 +45,72 @@ namespace detail {
  * @brief Represents an instance of the Breadth-First Search (BFS) algorithm on a graph.
  *
  * The BFSInstance struct encapsulates the necessary data and operations for performing the BFS algorithm on a graph.
- * It stores the graph, the source vertex, and arrays for distances and parents.
+ * It stores the graph, the source vertex, arrays for distances and parents and the frontiers used by the traversal.
+ * All of them are allocated once and reused by every traversal started with `reset`.
  */
 template<typename GraphType>
 struct BFSInstance {
   using vertex_t = typename GraphType::vertex_t;
   using edge_t = typename GraphType::edge_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
 
   GraphType& G;      /**< The graph on which the BFS algorithm will be performed. */
   vertex_t source;   /**< The source vertex for the BFS algorithm. */
   edge_t* distances; /**< Array to store the distances from the source vertex to each vertex in the graph. */
   vertex_t* parents; /**< Array to store the parent vertex of each vertex in the graph during the BFS traversal. */
 
+  frontiers_t frontiers; /**< Frontiers of the current and of the next iteration, with the device's bitmap word. */
+  bool dirty = false;    /**< True if a traversal did not complete and left the frontiers populated. */
+  sycl::event ready;     /**< Completion of the last reset. */
+
+  sygraph::frontier::ConvergenceCheck convergence;             /**< Host-pinned emptiness flags, kept across runs. */
+  sygraph::operators::advance::DirectionOptimizer<> optimizer; /**< Push/pull choice of the hybrid traversal. */ /**< Push/pull choice of the hybrid traversal. */
+  std::unique_ptr<PersistentBFS<GraphType>> persistent;        /**< Single-launch engine, created by its first run. */
+
   /**
    * @brief Constructs a BFSInstance object.
    *
    * @param G The graph on which the BFS algorithm will be performed.
-   * @param source The source vertex for the BFS algorithm.
    */
-  BFSInstance(GraphType& G, vertex_t source) : G(G), source(source) {
+  BFSInstance(GraphType& G)
+      : G(G), source(0), frontiers(G.getQueue(), G.getVertexCount()), convergence(G.getQueue()), optimizer(G) {
     sycl::queue& queue = G.getQueue();
     size_t size = G.getVertexCount();
 
-    // Initialize distances
     distances = memory::detail::memoryAlloc<edge_t, memory::space::device>(size, queue);
     parents = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
-    queue.fill(distances, static_cast<edge_t>(size + 1), size).wait_and_throw();
-    queue.fill(&distances[source], static_cast<edge_t>(0), 1);
-    // Initialize parents
-    queue.fill(parents, static_cast<vertex_t>(-1), size);
-    queue.wait_and_throw();
+  }
+
+  /**
+   * @brief Prepares a new traversal from the given source.
+   *
+   * Distances, parents and the input frontier are initialized by a single kernel, no memory is allocated.
+   *
+   * @param source The source vertex for the BFS algorithm.
+   */
+  void reset(vertex_t source) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    this->source = source;
+    auto distances = this->distances;
+    auto parents = this->parents;
+    frontiers.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
 
+      auto in_dev_frontier = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          distances[idx] = idx[0] == source ? static_cast<edge_t>(0) : static_cast<edge_t>(size + 1);
+          parents[idx] = static_cast<vertex_t>(-1);
+          if (idx[0] == source) { in_dev_frontier.insert(source); }
+        });
+      });
+    });
   }
 
   size_t getVisitedVertices() const {
@@ -131,110 +172,43 @@ public:
   /**
    * @brief Initializes the BFS algorithm with the given graph and source vertex.
    *
-   * @param G The graph on which the BFS algorithm will be performed.
+   * Buffers and frontiers are allocated on the first call only, later calls reset them in place.
+   *
    * @param source The source vertex for the BFS algorithm.
    */
-  void init(vertex_t& source) { _instance = std::make_unique<detail::BFSInstance<GraphType>>(_g, source); }
+  void init(vertex_t& source) {
+    if (!_instance) { _instance = std::make_unique<detail::BFSInstance<GraphType>>(_g); }
+    _instance->reset(source);
+  }
 
   /**
-   * @brief Resets the BFS algorithm.
+   * @brief Resets the BFS algorithm, releasing its buffers.
    */
   void reset() { _instance.reset(); }
 
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
   /**
    * @brief Runs the BFS algorithm.
    *
-   * @param direction The direction of the BFS traversal (push, pull, or hybrid).
-   * @param alpha The alpha parameter for the hybrid BFS heuristic. Used to switch from push to pull.
-   * @param beta The beta parameter for the hybrid BFS heuristic. Used to switch from pull to push.
+   * @param direction The direction of the BFS traversal (push, pull, or hybrid), or `persistent` for a push traversal run
+   * by a single kernel launch, which suits graphs with many levels. Devices that do not guarantee the work-groups of the
+   * launch to be resident at once run `persistent` as `push`.
+   * @param alpha The alpha parameter for the hybrid BFS heuristic. Used to switch from push to pull. Defaults to the tuning profile.
+   * @param beta The beta parameter for the hybrid BFS heuristic. Used to switch from pull to push. Defaults to the tuning profile.
    * @tparam EnableProfiling A boolean flag to enable profiling.
    * @throws std::runtime_error if the BFS instance is not initialized.
    */
-  BFSRunDetails run(bfs_direction direction = bfs_direction::push, float alpha = 1.0f, float beta = 1.0f) {
-    BFSRunDetails details;
+  BFSRunDetails run(bfs_direction direction = bfs_direction::push, std::optional<float> alpha = {}, std::optional<float> beta = {}) {
     if (!_instance) { throw std::runtime_error("BFS instance not initialized"); }
 
-    auto& G = _instance->G;
-    auto& source = _instance->source;
-    auto& distances = _instance->distances;
-    auto& parents = _instance->parents;
-
-    sycl::queue& queue = G.getQueue();
-
-    using load_balance_t = sygraph::operators::load_balancer;
-    using direction_t = sygraph::operators::direction;
-    using frontier_view_t = sygraph::frontier::frontier_view;
-    using frontier_impl_t = sygraph::frontier::frontier_type;
-
-    auto in_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(queue, G);
-    auto out_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(queue, G);
-
-    in_frontier.insert(source);
-
-    size_t size = G.getVertexCount();
-    auto g_device = G.getDeviceGraph();
-    int iter = 0;
-
-    sygraph::Event e;
-
-    auto push_step = [&]() {
-      return sygraph::operators::advance::frontier<load_balance_t::workgroup_mapped, frontier_view_t::vertex, frontier_view_t::vertex>(
-          G,
-          in_frontier,
-          out_frontier,
-          [=](auto src, auto dst, auto edge, auto weight) -> bool {
-            if (distances[dst] == size + 1) {
-              distances[dst] = iter + 1;
-              return true;
-            }
-            return false;
-          },
-          sygraph::frontier::size::fetch_from_memory);
-    };
-
-    auto pull_step = [&]() {
-      return sygraph::operators::advance::
-          frontier<direction_t::pull, load_balance_t::workgroup_mapped, frontier_view_t::vertex, frontier_view_t::vertex>(
-              G,
-              in_frontier,
-              out_frontier,
-              [=](auto src, auto dst, auto edge, auto weight) -> bool {
-                if (distances[src] == size + 1 && distances[dst] == iter) {
-                  distances[src] = iter + 1;
-                  return true;
-                }
-                return false;
-              },
-              sygraph::frontier::size::fetch_from_memory);
-    };
-
-    bool push = direction != bfs_direction::pull;
-    size_t n_push_step = 0;
-    size_t n_pull_step = 0;
-
-    while (!in_frontier.empty()) {
-      if (push) {
-        e = push_step();
-        details.push_steps.insert(iter);
-      } else {
-        e = pull_step();
-        details.pull_steps.insert(iter);
-      }
-      e.waitAndThrow();
-#ifdef ENABLE_PROFILING
-      sygraph::Profiler::addEvent(e, "advance");
-#endif
-      evaluateHeuristic(alpha, beta, out_frontier, direction, push);
-      sygraph::frontier::swap(in_frontier, out_frontier);
-      out_frontier.clear();
-      iter++;
-    }
-
-#ifdef ENABLE_PROFILING
-    sygraph::Profiler::addVisitedEdges(_instance->getVisitedEdges());
-#endif
-    details.iterations = iter;
-    return details;
+    const auto& tuning = sygraph::tuning::getProfile();
+    float a = alpha.value_or(tuning.bfs_alpha);
+    float b = beta.value_or(tuning.bfs_beta);
+    return _instance->frontiers.visit([&](auto& frontiers) { return runImpl(frontiers.in, frontiers.out, direction, a, b); });
   }
 
   /**
@@ -280,73 +254,160 @@ public:
 private:
   GraphType& _g;
   std::unique_ptr<detail::BFSInstance<GraphType>> _instance;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
 
-  template<typename F>
-  size_t fetchFrontierDegree(const F& frontier) {
-    size_t total_degree = 0;
+  template<typename FrontierT>
+  BFSRunDetails runImpl(FrontierT& in_frontier, FrontierT& out_frontier, bfs_direction direction, float alpha, float beta) {
+    BFSRunDetails details;
     auto& G = _instance->G;
-    auto g_device = G.getDeviceGraph();
+    auto& distances = _instance->distances;
+    const auto& tuning = sygraph::tuning::getProfile();
+    auto lb = _load_balancer.value_or(tuning.load_balancer);
+
+    using load_balance_t = sygraph::operators::load_balancer;
+    using direction_t = sygraph::operators::direction;
+    using frontier_view_t = sygraph::frontier::frontier_view;
 
-    auto e = sygraph::operators::compute::reduce<sygraph::frontier::frontier_view::vertex, sycl::plus<size_t>>(
-        G, frontier, total_degree, [=](auto v, auto& accumulator) { accumulator += g_device.getDegree(v); });
-    e.waitAndThrow();
+    _instance->ready.wait_and_throw();
+    _instance->dirty = true;
+
+    if (direction == bfs_direction::persistent && detail::PersistentBFS<GraphType>::template residentGroups<FrontierT>(G) == 0) {
+      // without resident work-groups the level barrier could wait forever, traverse level by level instead
+      direction = bfs_direction::push;
+    }
+
+    if (direction == bfs_direction::persistent) {
+      // the input frontier, holding the source, marks the visited vertices
+      if (!_instance->persistent) { _instance->persistent = std::make_unique<detail::PersistentBFS<GraphType>>(G); }
+      details.iterations = _instance->persistent->run(_instance->source, distances, in_frontier);
+      for (size_t i = 0; i < details.iterations; i++) { details.push_steps.insert(i); }
+      in_frontier.clear();
+      _instance->dirty = false;
 #ifdef ENABLE_PROFILING
-    sygraph::Profiler::addEvent(e, "computeFrontierDegree");
+      sygraph::Profiler::addVisitedEdges(_instance->getVisitedEdges());
 #endif
-    return total_degree;
-  }
+      return details;
+    }
 
-  uint32_t fetchUnexploredDegree() {
-    auto& G = _instance->G;
-    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
     auto g_device = G.getDeviceGraph();
+    int iter = 0;
 
-    sycl::buffer<uint32_t, 1> degree_buf(sycl::range<1>(1));
-
-    auto distances = _instance->distances;
-    size_t nodes = G.getVertexCount();
+    // recordings need the same launches on every iteration, which the automatic balancer does not guarantee
+    sygraph::IterationGraph replay(G.getQueue(), tuning.command_graph && direction != bfs_direction::hybrid && lb != load_balance_t::automatic);
+    // the hybrid traversal reads its direction back on every iteration, the others can run ahead of the host. A recording
+    // spans a whole period, rounded up to an even count so that the swapped frontiers are back in place after a replay
+    size_t period = direction == bfs_direction::hybrid ? 1 : tuning.convergence_period;
+    if (replay.enabled()) { period = std::max<size_t>(2, period + period % 2); }
+    auto& convergence = _instance->convergence;
+    convergence.reset(period);
+    const bool run_ahead = convergence.asynchronous() || replay.enabled();
+    const int expected_size = run_ahead ? sygraph::frontier::size::infer_from_device : sygraph::frontier::size::fetch_from_memory;
 
-    auto e = queue.submit([&](sycl::handler& cgh) {
-      auto sum_reduction = sycl::reduction<uint32_t>(degree_buf, cgh, sycl::plus<uint32_t>());
+    sygraph::Event e;
 
-      cgh.parallel_for<class compute_unexplored_degree_kernel>(sycl::range<1>(nodes), sum_reduction, [=](sycl::id<1> idx, auto& sum) {
-        size_t vertex = idx[0];
-        if (distances[vertex] == nodes + 1) { sum += static_cast<uint32_t>(g_device.getDegree(vertex)); }
+    auto push_step = [&]() {
+      return sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+        return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+            G,
+            in_frontier,
+            out_frontier,
+            [=](auto src, auto dst, auto edge, auto weight) -> bool {
+              if (distances[dst] == size + 1) {
+                distances[dst] = distances[src] + 1;
+                return true;
+              }
+              return false;
+            },
+            expected_size);
       });
-    });
-    e.wait();
-#ifdef ENABLE_PROFILING
-    sygraph::Profiler::addEvent(e, "computeUnexploredDegree");
-#endif
-    auto degree_host = degree_buf.get_host_access();
-    return degree_host[0];
-  }
+    };
 
-  template<typename F>
-  bool shouldSwitchToPull(const F& frontier, float alpha) {
-    uint32_t frontier_degree = fetchFrontierDegree(frontier);
-    uint32_t unexplored_degree = fetchUnexploredDegree();
+    auto hybrid_step = [&]() {
+      return sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+        return sygraph::operators::advance::frontier<direction_t::automatic, Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+            G,
+            in_frontier,
+            out_frontier,
+            [=](auto src, auto dst, auto edge, auto weight) -> bool {
+              if (distances[dst] == size + 1) {
+                distances[dst] = distances[src] + 1;
+                return true;
+              }
+              return false;
+            },
+            _instance->optimizer);
+      });
+    };
 
-    return frontier_degree > (unexplored_degree / alpha);
-  }
+    auto pull_step = [&]() {
+      return sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+        return sygraph::operators::advance::frontier<direction_t::pull, Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+            G,
+            in_frontier,
+            out_frontier,
+            [=](auto src, auto dst, auto edge, auto weight) -> bool {
+              if (distances[src] == size + 1) {
+                distances[src] = distances[dst] + 1;
+                return true;
+              }
+              return false;
+            },
+            expected_size);
+      });
+    };
 
-  template<typename F>
-  bool shouldSwitchToPush(const F& frontier, float beta) {
-    auto& G = _instance->G;
-    auto frontier_size = frontier.size();
-    auto total_nodes = G.getVertexCount();
-    return frontier_size < (total_nodes / beta);
-  }
+    if (direction == bfs_direction::hybrid) { _instance->optimizer.reset(alpha, beta); }
+
+    if (replay.enabled() && !in_frontier.empty()) {
+      // the host waits once per replay, the iterations run after the frontier emptied find nothing to do
+      bool converged = false;
+      while (!converged) {
+        replay.run([&]() {
+          for (size_t i = 0; i < convergence.period(); i++) {
+            direction == bfs_direction::push ? push_step() : pull_step();
+            sygraph::frontier::swap(in_frontier, out_frontier);
+            out_frontier.clear();
+            in_frontier.empty(convergence.slot(i));
+          }
+        });
+        converged = convergence.collect();
+      }
+      // the source level, plus every level that left a non-empty frontier
+      for (iter = 0; iter <= static_cast<int>(convergence.getIterations()); iter++) {
+        (direction == bfs_direction::push ? details.push_steps : details.pull_steps).insert(iter);
+      }
+    }
 
-  template<typename F>
-  void evaluateHeuristic(const float alpha, const float beta, const F& frontier, bfs_direction direction, bool& push) {
-    if (direction == bfs_direction::hybrid) {
-      if (push) {
-        if (shouldSwitchToPull(frontier, alpha)) { push = false; }
+    while (!replay.enabled() && !convergence.converged(in_frontier)) {
+      bool push = direction == bfs_direction::push;
+      if (direction == bfs_direction::hybrid) {
+        e = hybrid_step();
+        push = _instance->optimizer.isPush();
+      } else if (push) {
+        e = push_step();
       } else {
-        if (shouldSwitchToPush(frontier, beta)) { push = true; }
+        e = pull_step();
       }
+      (push ? details.push_steps : details.pull_steps).insert(iter);
+      if (!convergence.asynchronous()) { e.waitAndThrow(); }
+#ifdef ENABLE_PROFILING
+      sygraph::Profiler::addEvent(e, "advance");
+#endif
+      sygraph::frontier::swap(in_frontier, out_frontier);
+      out_frontier.clear();
+      iter++;
     }
+    _instance->dirty = false;
+
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addVisitedEdges(_instance->getVisitedEdges());
+#endif
+    // iterations run ahead of the convergence check found an empty frontier
+    details.iterations = replay.enabled() ? iter : convergence.getIterations();
+    details.push_steps.erase(details.push_steps.lower_bound(details.iterations), details.push_steps.end());
+    details.pull_steps.erase(details.pull_steps.lower_bound(details.iterations), details.pull_steps.end());
+    return details;
   }
 };
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/memory.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+
+namespace sygraph {
+namespace algorithms {
+namespace detail {
+
+template<typename GraphDevT, typename FrontierDevT>
+class persistent_bfs_kernel;
+
+/**
+ * @brief Counters of the persistent BFS, shared by all the work-groups of the launch.
+ */
+struct PersistentBFSState {
+  uint32_t sizes[2] = {1, 0}; ///< Lengths of the queues of the current and of the next level.
+  uint32_t arrived = 0;       ///< Work-groups that reached the level barrier.
+  uint32_t generation = 0;    ///< Level barriers completed.
+  uint32_t levels = 0;        ///< Levels that had vertices to expand, written when the traversal ends.
+};
+
+/**
+ * @brief Breadth-first traversal performed by a single kernel launch.
+ *
+ * Up to one work-group per compute unit stays resident for the whole traversal. The vertices of a level are read from a
+ * device-side queue, one per work-item, and the newly reached neighbors, claimed in an MLB frontier holding the visited
+ * vertices, are appended to the queue of the next level. Levels are separated by a barrier among the work-groups built
+ * on atomics, so the host launches the kernel once and only waits for its end. The barrier needs all the work-groups to
+ * be resident at the same time: the launch is capped to the work-groups the runtime guarantees to run concurrently,
+ * queried through `sycl_ext_oneapi_root_group`, and cannot be used where the extension is missing.
+ */
+template<typename GraphType>
+class PersistentBFS {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+
+  template<typename FrontierT>
+  using kernel_name_t = persistent_bfs_kernel<std::decay_t<decltype(std::declval<GraphType&>().getDeviceGraph())>,
+                                              std::decay_t<decltype(std::declval<const FrontierT&>().getDeviceFrontier())>>;
+
+public:
+  PersistentBFS(GraphType& G) : _G(G) {
+    sycl::queue& queue = G.getQueue();
+    const size_t size = G.getVertexCount();
+    _queues[0] = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    _queues[1] = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    _state = memory::detail::memoryAlloc<PersistentBFSState, memory::space::device>(1, queue);
+  }
+
+  PersistentBFS(const PersistentBFS&) = delete;
+  PersistentBFS& operator=(const PersistentBFS&) = delete;
+
+  ~PersistentBFS() {
+    sycl::queue& queue = _G.getQueue();
+    memory::detail::releaseUSM(_queues[0], queue);
+    memory::detail::releaseUSM(_queues[1], queue);
+    memory::detail::releaseUSM(_state, queue);
+  }
+
+  /**
+   * @brief Returns how many work-groups of the kernel the runtime guarantees to be resident at once on the graph's
+   * queue, or 0 when it grants no such guarantee and the traversal must not be launched.
+   *
+   * @tparam FrontierT The frontier marking the visited vertices.
+   */
+  template<typename FrontierT>
+  static size_t residentGroups(GraphType& G) {
+#ifdef SYCL_EXT_ONEAPI_ROOT_GROUP
+    sycl::queue& queue = G.getQueue();
+    try {
+      auto id = sycl::get_kernel_id<kernel_name_t<FrontierT>>();
+      auto bundle = sycl::get_kernel_bundle<sycl::bundle_state::executable>(queue.get_context(), {queue.get_device()}, {id});
+      return bundle.get_kernel(id).template ext_oneapi_get_info<sycl::ext::oneapi::experimental::info::kernel_queue_specific::max_num_work_group_sync>(
+          queue);
+    } catch (const sycl::exception&) { return 0; }
+#else
+    return 0;
+#endif
+  }
+
+  /**
+   * @brief Traverses the graph from `source`, which must be the only vertex of `visited`.
+   *
+   * @param source The source vertex, whose distance is already 0.
+   * @param distances The distances, `vertex count + 1` for the vertices not reached yet.
+   * @param visited The frontier marking the vertices reached, it holds all of them at the end.
+   * @return The number of levels that had vertices to expand.
+   * @throws std::runtime_error if `residentGroups` grants no work-group.
+   */
+  template<typename FrontierT>
+  size_t run(vertex_t source, edge_t* distances, const FrontierT& visited) {
+    sycl::queue& queue = _G.getQueue();
+    const auto& profile = sygraph::device::getProfile(queue);
+    const size_t local_size = profile.compute_unit_size;
+    const size_t resident = residentGroups<FrontierT>(_G);
+    if (resident == 0) { throw std::runtime_error("The device does not guarantee resident work-groups for the persistent BFS"); }
+    const size_t num_groups = std::min<size_t>(resident, std::max<uint32_t>(1, profile.num_compute_units));
+
+    PersistentBFSState init;
+    auto init_state = queue.copy(&init, _state, 1);
+    auto init_queue = queue.fill(_queues[0], source, 1);
+
+    auto graph_dev = _G.getDeviceGraph();
+    auto visited_dev = visited.getDeviceFrontier();
+    auto state = _state;
+    vertex_t* queues[2] = {_queues[0], _queues[1]};
+
+    auto kernel = [=](sycl::nd_item<1> item) {
+      using counter_ref = sycl::atomic_ref<uint32_t, sycl::memory_order::acq_rel, sycl::memory_scope::device>;
+      auto group = item.get_group();
+      const size_t global_id = item.get_global_linear_id();
+      const size_t global_size = item.get_global_range(0);
+
+      uint32_t level = 0;
+      while (true) {
+        const uint32_t current = level & 1;
+        const uint32_t size = counter_ref(state->sizes[current]).load();
+        if (size == 0) { break; }
+
+        for (size_t i = global_id; i < size; i += global_size) {
+          const vertex_t vertex = queues[current][i];
+          for (auto it = graph_dev.begin(vertex); it != graph_dev.end(vertex); ++it) {
+            const vertex_t neighbor = *it;
+            if (!visited_dev.tryInsert(neighbor)) { continue; }
+            distances[neighbor] = level + 1;
+            queues[current ^ 1][counter_ref(state->sizes[current ^ 1]).fetch_add(1)] = neighbor;
+          }
+        }
+
+        // level barrier: the last work-group to arrive empties the queue just read and releases the others
+        sycl::atomic_fence(sycl::memory_order::seq_cst, sycl::memory_scope::device);
+        sycl::group_barrier(group);
+        if (group.leader()) {
+          counter_ref generation(state->generation);
+          const uint32_t expected = generation.load();
+          if (counter_ref(state->arrived).fetch_add(1) == num_groups - 1) {
+            counter_ref(state->arrived).store(0);
+            counter_ref(state->sizes[current]).store(0);
+            generation.store(expected + 1);
+          } else {
+            while (generation.load() == expected) {}
+          }
+        }
+        sycl::group_barrier(group);
+        sycl::atomic_fence(sycl::memory_order::seq_cst, sycl::memory_scope::device);
+        level++;
+      }
+      if (global_id == 0) { state->levels = level; }
+    };
+
+    sygraph::Event e = queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on({init_state, init_queue});
+      const sycl::nd_range<1> range{num_groups * local_size, local_size};
+#ifdef SYCL_EXT_ONEAPI_ROOT_GROUP
+      // launched as a root group, so that the runtime honors the residency it reported
+      sycl::ext::oneapi::experimental::properties properties{sycl::ext::oneapi::experimental::use_root_sync};
+      cgh.parallel_for<kernel_name_t<FrontierT>>(range, properties, kernel);
+#else
+      cgh.parallel_for<kernel_name_t<FrontierT>>(range, kernel);
+#endif
+    });
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addEvent(e, "persistentBFS");
+#endif
+
+    e.waitAndThrow();
+    PersistentBFSState result;
+    queue.copy(_state, &result, 1).wait();
+    return result.levels;
+  }
+
+private:
+  GraphType& _G;
+  vertex_t* _queues[2];
+  PersistentBFSState* _state;
+};
+
+} // namespace detail
+} // namespace algorithms
+} // namespace sygraph
@@ -6,15 +6,21 @@
 
 #include <sycl/sycl.hpp>
 
+#include <sygraph/frontier/convergence.hpp>
 #include <sygraph/frontier/frontier.hpp>
 #include <sygraph/graph/graph.hpp>
 #include <sygraph/operators/advance/advance.hpp>
 #include <sygraph/operators/for/for.hpp>
+#include <sygraph/sycl/command_graph.hpp>
 #include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/tuning.hpp>
 #ifdef ENABLE_PROFILING
 #include <sygraph/utils/profiler.hpp>
 #endif
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <vector>
 
 /**
  * @namespace sygraph
@@ -29,29 +35,62 @@ namespace detail {
  * @brief Represents an instance of the Breadth-First Search (CC) algorithm on a graph.
  *
  * The CCInstance struct encapsulates the necessary data and operations for performing the CC algorithm on a graph.
- * It stores the graph, the source vertex, and arrays for distances and parents.
+ * It stores the graph, the source vertex, the labels array and the frontiers, which are reused across runs.
  */
 template<typename GraphType>
 struct CCInstance {
   using vertex_t = typename GraphType::vertex_t;
   using edge_t = typename GraphType::edge_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
 
   GraphType& G;     /**< The graph on which the CC algorithm will be performed. */
   vertex_t source;  /**< The source vertex for the CC algorithm. */
   vertex_t* labels; /**< Array to store the labels of each vertex in the graph during the CC traversal. */
 
+  frontiers_t frontiers; /**< Frontiers of the current and of the next iteration, with the device's bitmap word. */
+  bool dirty = false;    /**< True if a run did not complete and left the frontiers populated. */
+  sycl::event ready;     /**< Completion of the last reset. */
+
+  sygraph::frontier::ConvergenceCheck convergence; /**< Host-pinned emptiness flags, kept across runs. */
+
+  /** Push/pull choice of the label propagation, pulling into every vertex since frontier labels can still grow. */
+  sygraph::operators::advance::DirectionOptimizer<sygraph::operators::direction::pull_all, sygraph::frontier::frontier_view::graph, true> optimizer;
+
   /**
    * @brief Constructs a CCInstance object.
    *
    * @param G The graph on which the CC algorithm will be performed.
+   */
+  CCInstance(GraphType& G) : G(G), source(0), frontiers(G.getQueue(), G.getVertexCount()), convergence(G.getQueue()), optimizer(G) {
+    labels = memory::detail::memoryAlloc<vertex_t, memory::space::device>(G.getVertexCount(), G.getQueue());
+  }
+
+  /**
+   * @brief Initializes the labels and the input frontier for a new source with a single kernel.
+   *
    * @param source The source vertex for the CC algorithm.
    */
-  CCInstance(GraphType& G, vertex_t source) : G(G), source(source) {
+  void reset(vertex_t source) {
     sycl::queue& queue = G.getQueue();
-    size_t size = G.getVertexCount();
 
-    labels = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
-    queue.fill(labels, static_cast<vertex_t>(-1), size).wait();
+    this->source = source;
+    auto labels = this->labels;
+    frontiers.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto in_dev_frontier = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(G.getVertexCount()), [=](sycl::item<1> item) {
+          vertex_t i = item.get_id();
+          labels[i] = i;
+          if (i == source) { in_dev_frontier.insert(source); }
+        });
+      });
+    });
   }
 
   /**
@@ -84,16 +123,38 @@ public:
   /**
    * @brief Initializes the CC algorithm with the given graph and source vertex.
    *
-   * @param G The graph on which the CC algorithm will be performed.
+   * Buffers and frontiers are allocated on the first call only, later calls reset them in place.
+   *
    * @param source The source vertex for the CC algorithm.
    */
-  void init(vertex_t& source) { _instance = std::make_unique<detail::CCInstance<GraphType>>(_g, source); }
+  void init(vertex_t& source) {
+    if (!_instance) { _instance = std::make_unique<detail::CCInstance<GraphType>>(_g); }
+    _instance->reset(source);
+  }
 
   /**
-   * @brief Resets the CC algorithm.
+   * @brief Resets the CC algorithm, releasing its buffers.
    */
   void reset() { _instance.reset(); }
 
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
+  /**
+   * @brief Sets the direction of the advances: `direction::push`, the default, or `direction::automatic`, which pulls
+   * the labels into every vertex while the frontier is large.
+   *
+   * @throws std::runtime_error for the other directions.
+   */
+  void setDirection(sygraph::operators::direction direction) {
+    if (direction != sygraph::operators::direction::push && direction != sygraph::operators::direction::automatic) {
+      throw std::runtime_error("CC supports the push and automatic directions only");
+    }
+    _direction = direction;
+  }
+
   /**
    * @brief Runs the CC algorithm.
    *
@@ -105,67 +166,100 @@ public:
     if (!_instance) { throw std::runtime_error("CC instance not initialized"); }
 
     auto& G = _instance->G;
-    auto& source = _instance->source;
     auto& labels = _instance->labels;
+    const auto& tuning = sygraph::tuning::getProfile();
+    auto lb = _load_balancer.value_or(tuning.load_balancer);
+    _instance->frontiers.visit([&](auto& frontiers) {
+      auto& in_frontier = frontiers.in;
+      auto& out_frontier = frontiers.out;
 
-    sycl::queue& queue = G.getQueue();
+      using load_balance_t = sygraph::operators::load_balancer;
+      using frontier_view_t = sygraph::frontier::frontier_view;
+      using direction_t = sygraph::operators::direction;
 
-    using load_balance_t = sygraph::operators::load_balancer;
-    using direction_t = sygraph::operators::direction;
-    using frontier_view_t = sygraph::frontier::frontier_view;
-    using frontier_impl_t = sygraph::frontier::frontier_type;
+      _instance->ready.wait_and_throw();
+      _instance->dirty = true;
 
-    auto in_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(queue, G);
-    auto out_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(queue, G);
+      int iter = 0;
+      auto propagate = [=](auto src, auto dst, auto edge, auto weight) -> bool {
+        vertex_t src_label = sygraph::sync::load(&labels[src]);
+        vertex_t dst_label = sygraph::sync::load(&labels[dst]);
+        if (dst_label < src_label) {
+          sygraph::sync::store(&labels[dst], src_label);
+          return true;
+        }
+        return false;
+      };
 
-    queue
-        .submit([&](sycl::handler& cgh) {
-          cgh.parallel_for(sycl::range<1>(G.getVertexCount()), [=](sycl::item<1> item) {
-            vertex_t i = item.get_id();
-            labels[i] = i;
-          });
-        })
-        .wait();
+      auto e1 = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+        return sygraph::operators::advance::vertices<Lb, frontier_view_t::vertex>(G, in_frontier, propagate);
+      });
+      e1.waitAndThrow();
+      if (_direction == direction_t::automatic) { _instance->optimizer.reset(); }
 
-    in_frontier.insert(source);
+      const bool recordable = tuning.command_graph && _direction != direction_t::automatic && lb != load_balance_t::automatic;
+      sygraph::IterationGraph replay(G.getQueue(), recordable);
+      // the automatic direction reads its choice back on every iteration, push advances can run ahead of the host. A
+      // recording spans a whole period, rounded up to an even count so that the swapped frontiers are back in place
+      size_t period = _direction == direction_t::automatic ? 1 : tuning.convergence_period;
+      if (replay.enabled()) { period = std::max<size_t>(2, period + period % 2); }
+      auto& convergence = _instance->convergence;
+      convergence.reset(period);
+      const bool run_ahead = convergence.asynchronous() || replay.enabled();
+      const int expected_size = run_ahead ? sygraph::frontier::size::infer_from_device : sygraph::frontier::size::fetch_from_memory;
 
-    size_t size = G.getVertexCount();
-    int iter = 0;
+      if (replay.enabled()) {
+        // the host waits once per replay, the iterations run after the frontier emptied find nothing to do
+        bool converged = in_frontier.empty();
+        while (!converged) {
+          replay.run([&]() {
+            for (size_t i = 0; i < convergence.period(); i++) {
+              sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+                return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+                    G, in_frontier, out_frontier, propagate, expected_size);
+              });
+              sygraph::frontier::swap(in_frontier, out_frontier);
+              out_frontier.clear();
+              in_frontier.empty(convergence.slot(i));
+            }
+          });
+          converged = convergence.collect();
+        }
+      }
 
-    auto e1 = sygraph::operators::advance::vertices<load_balance_t::workgroup_mapped, frontier_view_t::vertex>(
-        G, in_frontier, [=](auto src, auto dst, auto edge, auto weight) -> bool {
-          vertex_t src_label = sygraph::sync::load(&labels[src]);
-          vertex_t dst_label = sygraph::sync::load(&labels[dst]);
-          if (dst_label < src_label) {
-            sygraph::sync::store(&labels[dst], src_label);
-            return true;
+      while (!replay.enabled() && !convergence.converged(in_frontier)) {
+        auto e1 = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+          if (_direction == direction_t::automatic) {
+            return sygraph::operators::advance::frontier<direction_t::automatic, Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+                G, in_frontier, out_frontier, propagate, _instance->optimizer);
           }
-          return false;
+          return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+              G, in_frontier, out_frontier, propagate, expected_size);
         });
-    e1.waitAndThrow();
-
-    // TODO: Add automatic load_balancing for the type of graph.
-    while (!in_frontier.empty()) {
-      auto e1 = sygraph::operators::advance::frontier<load_balance_t::workgroup_mapped, frontier_view_t::vertex, frontier_view_t::vertex>(
-          G, in_frontier, out_frontier, [=](auto src, auto dst, auto edge, auto weight) -> bool {
-            vertex_t src_label = sygraph::sync::load(&labels[src]);
-            vertex_t dst_label = sygraph::sync::load(&labels[dst]);
-            if (dst_label < src_label) {
-              sygraph::sync::store(&labels[dst], src_label);
-              return true;
-            }
-            return false;
-          });
-      e1.waitAndThrow();
+        if (!convergence.asynchronous()) { e1.waitAndThrow(); }
 
 #ifdef ENABLE_PROFILING
-      sygraph::Profiler::addEvent(e1, "advance");
+        sygraph::Profiler::addEvent(e1, "advance");
 #endif
 
-      sygraph::frontier::swap(in_frontier, out_frontier);
-      out_frontier.clear();
-      iter++;
-    }
+        sygraph::frontier::swap(in_frontier, out_frontier);
+        out_frontier.clear();
+        iter++;
+      }
+    });
+    _instance->dirty = false;
+  }
+
+  /**
+   * @brief Returns the component labels of all vertices in the graph, the largest vertex id of each component.
+   *
+   * @return A vector of labels.
+   */
+  std::vector<vertex_t> getLabels() const {
+    if (!_instance) { throw std::runtime_error("CC instance not initialized"); }
+    std::vector<vertex_t> labels(_instance->G.getVertexCount());
+    _instance->G.getQueue().copy(_instance->labels, labels.data(), labels.size()).wait();
+    return labels;
   }
 
   /**
@@ -189,6 +283,8 @@ public:
 private:
   GraphType& _g;
   std::unique_ptr<detail::CCInstance<GraphType>> _instance;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
+  sygraph::operators::direction _direction = sygraph::operators::direction::push;
 };
 
 } // namespace algorithms
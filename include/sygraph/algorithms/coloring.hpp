@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <bit>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <sygraph/frontier/frontier.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/filter/filter.hpp>
+#include <sygraph/operators/for/for.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/scan.hpp>
+
+
+namespace sygraph {
+namespace algorithms {
+namespace detail {
+
+template<typename GraphType>
+struct ColoringInstance {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
+  static constexpr uint32_t uncolored = static_cast<uint32_t>(-1);
+
+  GraphType& G;
+  uint32_t* colors;
+  uint32_t* max_color;      // the largest color, reduced once the coloring is proper
+  vertex_t* class_vertices; // the vertices grouped by color
+  std::vector<size_t> class_offsets;
+  size_t rounds = 0;
+
+  frontiers_t frontiers; // the vertices to color at this round, and those of them in conflict
+  bool dirty = false;    // set while a run is in progress, the frontiers must be cleared if it did not complete
+  sycl::event ready;
+
+  ColoringInstance(GraphType& G) : G(G), frontiers(G.getQueue(), G.getVertexCount()) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    colors = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+    max_color = memory::detail::memoryAlloc<uint32_t, memory::space::device>(1, queue);
+    class_vertices = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+  }
+
+  /**
+   * @brief Leaves every vertex uncolored, and puts all vertices in the frontier, in one kernel.
+   */
+  void reset() {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    auto colors = this->colors;
+    rounds = 0;
+    class_offsets.assign(1, 0);
+    frontiers.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto in_dev = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          colors[idx[0]] = uncolored;
+          in_dev.insert(static_cast<vertex_t>(idx[0]));
+        });
+      });
+    });
+  }
+
+  /**
+   * @brief Groups the vertices by color with a counting sort, and keeps the offsets of the classes on the host.
+   */
+  void buildColorClasses() {
+    sycl::queue& queue = G.getQueue();
+    const size_t size = G.getVertexCount();
+    auto colors = this->colors;
+    auto max_color = this->max_color;
+    auto class_vertices = this->class_vertices;
+
+    queue.fill(max_color, 0U, 1).wait();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), sycl::reduction(max_color, 0U, sycl::maximum<uint32_t>()), [=](sycl::id<1> idx, auto& acc) {
+         acc.combine(colors[idx[0]]);
+       });
+     }).wait_and_throw();
+    uint32_t num_colors = 0;
+    queue.copy(max_color, &num_colors, 1).wait();
+    num_colors = size > 0 ? num_colors + 1 : 0;
+
+    size_t* offsets = memory::detail::memoryAlloc<size_t, memory::space::device>(num_colors + 1, queue);
+    size_t* cursors = memory::detail::memoryAlloc<size_t, memory::space::device>(num_colors + 1, queue);
+    queue.fill(cursors, size_t{0}, num_colors + 1).wait();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) { sygraph::sync::atomicFetchAdd(cursors + colors[idx[0]], size_t{1}); });
+     }).wait_and_throw();
+    sygraph::scan::exclusiveSum(queue, cursors, offsets, num_colors);
+    queue.copy(offsets, cursors, num_colors + 1).wait();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+         class_vertices[sygraph::sync::atomicFetchAdd(cursors + colors[idx[0]], size_t{1})] = static_cast<vertex_t>(idx[0]);
+       });
+     }).wait_and_throw();
+
+    class_offsets.resize(num_colors + 1);
+    queue.copy(offsets, class_offsets.data(), num_colors + 1).wait();
+    memory::detail::releaseUSM(offsets, queue);
+    memory::detail::releaseUSM(cursors, queue);
+  }
+
+  ~ColoringInstance() {
+    sycl::queue& queue = G.getQueue();
+    memory::detail::releaseUSM(colors, queue);
+    memory::detail::releaseUSM(max_color, queue);
+    memory::detail::releaseUSM(class_vertices, queue);
+  }
+};
+} // namespace detail
+
+
+/**
+ * @class Coloring
+ * @brief Computes a proper vertex coloring of an undirected graph, with speculative assignments and conflict
+ * resolution.
+ *
+ * No two neighbors get the same color, and every vertex gets the smallest color not taken by its neighbors when it is
+ * colored, so at most `max degree + 1` colors are used. The vertices of a color class can be updated together without
+ * races, so the classes can schedule Gauss-Seidel-style updates, or replace atomics with one kernel per class.
+ *
+ * @tparam GraphType The type of the graph to color.
+ */
+template<typename GraphType>
+class Coloring {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+
+public:
+  Coloring(GraphType& g) : _g(g) {};
+
+  /**
+   * @brief Initializes the coloring.
+   *
+   * The instance holding colors and frontiers is created on the first call only; later calls reset it in place
+   * without allocating memory.
+   *
+   * @throws std::runtime_error if the graph is directed.
+   */
+  void init() {
+    if (_g.getProperties().directed) { throw std::runtime_error("Coloring: the graph must be undirected"); }
+    if (!_instance) { _instance = std::make_unique<detail::ColoringInstance<GraphType>>(_g); }
+    _instance->reset();
+  }
+
+  /**
+   * @brief Resets the internal state of the instance.
+   *
+   * This function destroys the internal instance, releasing its buffers.
+   */
+  void reset() { _instance.reset(); }
+
+  /**
+   * @brief Runs the coloring.
+   *
+   * The function performs the following steps while the frontier is not empty:
+   * 1. Every vertex of the frontier takes the smallest color not used by its neighbors, reading their colors while
+   *    they may be changing. A work-item collects the forbidden colors in a 64-bit mask, moving to the next 64 colors
+   *    only when all of them are taken.
+   * 2. `filter::external` collects the vertices that got the color of a neighbor of smaller id, which recolor at the
+   *    next round. The vertex of smallest id of the frontier always keeps its color, so every round makes progress.
+   *
+   * The vertices are then grouped into their color classes.
+   *
+   * @throws std::runtime_error if the instance is not initialized.
+   */
+  template<bool EnableProfiling = false>
+  void run() {
+    if (!_instance) { throw std::runtime_error("Coloring instance not initialized"); }
+
+    auto& G = _instance->G;
+    auto graph_dev = G.getDeviceGraph();
+    auto colors = _instance->colors;
+    _instance->frontiers.visit([&](auto& frontiers) {
+      using frontier_view_t = sygraph::frontier::frontier_view;
+      auto& in = frontiers.in;
+      auto& out = frontiers.out;
+
+      _instance->ready.wait_and_throw();
+      _instance->dirty = true;
+
+      while (!in.empty()) {
+        auto e1 = sygraph::operators::compute::execute<frontier_view_t::vertex>(G, in, [=](auto v) {
+          const auto vertex = static_cast<vertex_t>(v);
+          for (uint32_t base = 0;; base += 64) {
+            uint64_t forbidden = 0;
+            for (auto it = graph_dev.begin(vertex); it != graph_dev.end(vertex); ++it) {
+              const uint32_t color = colors[*it];
+              if (*it != vertex && color >= base && color - base < 64) { forbidden |= uint64_t{1} << (color - base); }
+            }
+            if (forbidden != ~uint64_t{0}) {
+              colors[vertex] = base + static_cast<uint32_t>(std::countr_one(forbidden));
+              return;
+            }
+          }
+        });
+        e1.waitAndThrow();
+
+        auto e2 = sygraph::operators::filter::external(G, in, out, [=](auto v) {
+          const auto vertex = static_cast<vertex_t>(v);
+          for (auto it = graph_dev.begin(vertex); it != graph_dev.end(vertex); ++it) {
+            if (*it < vertex && colors[*it] == colors[vertex]) { return true; }
+          }
+          return false;
+        });
+        e2.waitAndThrow();
+#ifdef ENABLE_PROFILING
+        sygraph::Profiler::addEvent(e1, "assign");
+        sygraph::Profiler::addEvent(e2, "conflicts");
+#endif
+        sygraph::frontier::swap(in, out);
+        _instance->rounds++;
+      }
+    });
+    _instance->dirty = false;
+    _instance->buildColorClasses();
+  }
+
+  /**
+   * @brief Returns the color of a vertex, from 0 to `getColorCount() - 1`.
+   */
+  uint32_t getColor(size_t vertex) const {
+    if (!_instance) { throw std::runtime_error("Coloring instance not initialized"); }
+    uint32_t value = 0;
+    _g.getQueue().copy(_instance->colors + vertex, &value, 1).wait();
+    return value;
+  }
+
+  /**
+   * @brief Returns the colors of all vertices, in device memory.
+   */
+  const uint32_t* getColors() const {
+    if (!_instance) { throw std::runtime_error("Coloring instance not initialized"); }
+    return _instance->colors;
+  }
+
+  /**
+   * @brief Returns the number of colors used.
+   */
+  size_t getColorCount() const {
+    if (!_instance) { throw std::runtime_error("Coloring instance not initialized"); }
+    return _instance->class_offsets.size() - 1;
+  }
+
+  /**
+   * @brief Returns the vertices grouped by color, in device memory, in no particular order within a class.
+   *
+   * The vertices of color `c` are those between `getColorOffsets()[c]` and `getColorOffsets()[c + 1]`.
+   */
+  const vertex_t* getColorClasses() const {
+    if (!_instance) { throw std::runtime_error("Coloring instance not initialized"); }
+    return _instance->class_vertices;
+  }
+
+  /**
+   * @brief Returns the offsets of the color classes in `getColorClasses()`, one more than the number of colors.
+   */
+  const std::vector<size_t>& getColorOffsets() const {
+    if (!_instance) { throw std::runtime_error("Coloring instance not initialized"); }
+    return _instance->class_offsets;
+  }
+
+  /**
+   * @brief Returns the number of rounds of speculative assignments run.
+   */
+  size_t getRoundCount() const {
+    if (!_instance) { throw std::runtime_error("Coloring instance not initialized"); }
+    return _instance->rounds;
+  }
+
+private:
+  GraphType& _g;
+  std::unique_ptr<detail::ColoringInstance<GraphType>> _instance;
+};
+
+} // namespace algorithms
+} // namespace sygraph
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include <sygraph/frontier/frontier.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/advance/advance.hpp>
+#include <sygraph/operators/filter/filter.hpp>
+#include <sygraph/operators/for/for.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/tuning.hpp>
+
+
+namespace sygraph {
+namespace algorithms {
+namespace detail {
+
+template<typename GraphType>
+struct KCoreInstance {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
+
+  GraphType& G;
+  uint32_t* degrees;  // the degree of every vertex among the vertices not yet peeled
+  uint32_t* coreness; // the core number of every peeled vertex
+  uint32_t* peeled;   // 1 once a vertex has been assigned its core number
+  uint32_t max_coreness = 0;
+
+  frontiers_t bucket;    // the vertices peeled at the current k, and those whose degree drops to k while peeling
+  frontiers_t remaining; // the vertices not yet peeled, and the scratch frontier they are rebuilt into
+  bool dirty = false;    // set while a run is in progress, the frontiers must be cleared if it did not complete
+  sycl::event ready;
+
+  KCoreInstance(GraphType& G) : G(G), bucket(G.getQueue(), G.getVertexCount()), remaining(G.getQueue(), G.getVertexCount()) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    degrees = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+    coreness = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+    peeled = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+  }
+
+  /**
+   * @brief Initializes the degrees and core numbers, and fills the frontier of the remaining vertices, in one kernel.
+   */
+  void reset() {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    auto degrees = this->degrees;
+    auto coreness = this->coreness;
+    auto peeled = this->peeled;
+    auto graph_dev = G.getDeviceGraph();
+    max_coreness = 0;
+    bucket.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+      }
+    });
+    remaining.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto remaining_dev = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          const auto vertex = static_cast<vertex_t>(idx[0]);
+          degrees[vertex] = static_cast<uint32_t>(graph_dev.getDegree(vertex));
+          coreness[vertex] = 0;
+          peeled[vertex] = 0;
+          remaining_dev.insert(vertex);
+        });
+      });
+    });
+  }
+
+  ~KCoreInstance() {
+    sycl::queue& queue = G.getQueue();
+    memory::detail::releaseUSM(degrees, queue);
+    memory::detail::releaseUSM(coreness, queue);
+    memory::detail::releaseUSM(peeled, queue);
+  }
+};
+} // namespace detail
+
+
+/**
+ * @class KCore
+ * @brief Computes the core number of every vertex of an undirected graph by parallel peeling.
+ *
+ * The core number of a vertex is the largest k such that the vertex belongs to a subgraph whose vertices all have
+ * degree at least k. Vertices below a given core can be pruned with a filter on `getCoreness` before running heavier
+ * algorithms.
+ *
+ * @tparam GraphType The type of the graph on which the decomposition is computed.
+ */
+template<typename GraphType>
+class KCore {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+
+public:
+  KCore(GraphType& g) : _g(g) {};
+
+  /**
+   * @brief Initializes the decomposition.
+   *
+   * The instance holding degrees, core numbers and frontiers is created on the first call only; later calls reset it
+   * in place without allocating memory.
+   */
+  void init() {
+    if (!_instance) { _instance = std::make_unique<detail::KCoreInstance<GraphType>>(_g); }
+    _instance->reset();
+  }
+
+  /**
+   * @brief Resets the internal state of the instance.
+   *
+   * This function destroys the internal instance, releasing its buffers.
+   */
+  void reset() { _instance.reset(); }
+
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
+  /**
+   * @brief Runs the decomposition.
+   *
+   * The function performs the following steps while vertices remain:
+   * 1. A minimum reduction over the remaining vertices finds the smallest remaining degree, and k jumps to it when it
+   *    is larger, skipping the empty buckets.
+   * 2. `filter::external` builds the bucket of the remaining vertices of degree at most k.
+   * 3. Until the bucket is empty, its vertices get core number k and are peeled, and an advance decrements the degree
+   *    of their remaining neighbors, collecting into the next bucket those whose degree drops to k.
+   * 4. `filter::external` rebuilds the frontier of the remaining vertices without the peeled ones.
+   *
+   * @throws std::runtime_error if the instance is not initialized.
+   */
+  template<bool EnableProfiling = false>
+  void run() {
+    if (!_instance) { throw std::runtime_error("KCore instance not initialized"); }
+
+    auto& G = _instance->G;
+    auto degrees = _instance->degrees;
+    auto coreness = _instance->coreness;
+    auto peeled = _instance->peeled;
+    auto lb = _load_balancer.value_or(sygraph::tuning::getProfile().load_balancer);
+    _instance->bucket.visit([&](auto& bucket) {
+      _instance->remaining.visit([&](auto& remaining) {
+        // both pairs are created for the same queue, hence with the same bitmap word
+        if constexpr (std::is_same_v<std::decay_t<decltype(bucket)>, std::decay_t<decltype(remaining)>>) {
+          using load_balance_t = sygraph::operators::load_balancer;
+          using frontier_view_t = sygraph::frontier::frontier_view;
+
+          _instance->ready.wait_and_throw();
+          _instance->dirty = true;
+
+          uint32_t k = 0;
+          while (!remaining.in.empty()) {
+            uint32_t min_degree = std::numeric_limits<uint32_t>::max();
+            auto e1 = sygraph::operators::compute::reduce<frontier_view_t::vertex, sycl::minimum<uint32_t>>(
+                G, remaining.in, min_degree, [=](auto vertex, auto& acc) { acc.combine(degrees[vertex]); });
+            e1.waitAndThrow();
+            k = std::max(k, min_degree);
+
+            auto e2 = sygraph::operators::filter::external(G, remaining.in, bucket.in, [=](auto vertex) { return degrees[vertex] <= k; });
+            e2.waitAndThrow();
+#ifdef ENABLE_PROFILING
+            sygraph::Profiler::addEvent(e1, "min_degree");
+            sygraph::Profiler::addEvent(e2, "bucket");
+#endif
+
+            while (!bucket.in.empty()) {
+              auto e3 = sygraph::operators::compute::execute<frontier_view_t::vertex>(G, bucket.in, [=](auto vertex) {
+                coreness[vertex] = k;
+                peeled[vertex] = 1;
+              });
+              e3.waitAndThrow();
+
+              // a neighbor enters the next bucket on the decrement that takes its degree from k + 1 to k
+              auto decrement = [=](auto src, auto dst, auto edge, auto weight) -> bool {
+                if (peeled[dst] != 0) { return false; }
+                return sygraph::sync::atomicFetchSub(degrees + dst, 1U) == k + 1;
+              };
+              auto e4 = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+                return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+                    G, bucket.in, bucket.out, decrement);
+              });
+              e4.waitAndThrow();
+#ifdef ENABLE_PROFILING
+              sygraph::Profiler::addEvent(e3, "peel");
+              sygraph::Profiler::addEvent(e4, "advance");
+#endif
+
+              sygraph::frontier::swap(bucket.in, bucket.out);
+              bucket.out.clear();
+            }
+
+            auto e5 = sygraph::operators::filter::external(G, remaining.in, remaining.out, [=](auto vertex) { return peeled[vertex] == 0; });
+            e5.waitAndThrow();
+#ifdef ENABLE_PROFILING
+            sygraph::Profiler::addEvent(e5, "filter");
+#endif
+            sygraph::frontier::swap(remaining.in, remaining.out);
+          }
+          _instance->max_coreness = k;
+        }
+      });
+    });
+    _instance->dirty = false;
+  }
+
+  /**
+   * @brief Returns the core number of a vertex.
+   */
+  uint32_t getCoreness(size_t vertex) const {
+    if (!_instance) { throw std::runtime_error("KCore instance not initialized"); }
+    uint32_t value = 0;
+    _g.getQueue().copy(_instance->coreness + vertex, &value, 1).wait();
+    return value;
+  }
+
+  /**
+   * @brief Returns the core numbers of all vertices, in device memory.
+   */
+  const uint32_t* getCoreness() const {
+    if (!_instance) { throw std::runtime_error("KCore instance not initialized"); }
+    return _instance->coreness;
+  }
+
+  /**
+   * @brief Returns the largest core number, the degeneracy of the graph.
+   */
+  uint32_t getMaxCoreness() const {
+    if (!_instance) { throw std::runtime_error("KCore instance not initialized"); }
+    return _instance->max_coreness;
+  }
+
+private:
+  GraphType& _g;
+  std::unique_ptr<detail::KCoreInstance<GraphType>> _instance;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
+};
+
+} // namespace algorithms
+} // namespace sygraph
@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <bit>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#include <sygraph/frontier/frontier.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/advance/advance.hpp>
+#include <sygraph/operators/filter/filter.hpp>
+#include <sygraph/operators/for/for.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/tuning.hpp>
+
+
+namespace sygraph {
+namespace algorithms {
+
+/**
+ * @brief How the vertices of an iteration of label propagation see the labels of the others.
+ */
+enum class lpa_mode {
+  synchronous,     ///< All vertices update together from the labels of the previous iteration.
+  semi_synchronous ///< The vertices of even id update first, and those of odd id then see their new labels.
+};
+
+namespace detail {
+
+template<typename GraphType>
+struct LabelPropagationInstance {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
+
+  // vertices up to this degree find the most frequent label of their neighbors alone, the others with a work-group
+  static constexpr size_t work_item_degree = 32;
+
+  GraphType& G;
+  vertex_t* labels;
+  vertex_t* next_labels;    // the labels computed by an iteration, applied once all vertices have read the old ones
+  uint32_t* changed;        // 1 for the vertices whose label changed in the current half-iteration
+  vertex_t* sorted;         // the neighbor labels of the work-group vertices, sorted in place at their edge offsets
+  vertex_t* group_vertices; // the active vertices above `work_item_degree`
+  uint32_t* group_count;
+  size_t iterations = 0;
+
+  frontiers_t active;  // the vertices that may change label at this iteration, and at the next one
+  frontiers_t changes; // the vertices whose label changed in the current half-iteration
+  bool dirty = false;  // set once a run started, the frontiers then keep its last iteration until the next reset
+  sycl::event ready;
+
+  LabelPropagationInstance(GraphType& G)
+      : G(G), active(G.getQueue(), G.getVertexCount()), changes(G.getQueue(), G.getVertexCount()) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    labels = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    next_labels = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    changed = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+    sorted = memory::detail::memoryAlloc<vertex_t, memory::space::device>(std::max<size_t>(1, G.getEdgeCount()), queue);
+    group_vertices = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    group_count = memory::detail::memoryAlloc<uint32_t, memory::space::device>(1, queue);
+  }
+
+  /**
+   * @brief Gives every vertex its own id as label, and makes all vertices active, in one kernel.
+   */
+  void reset() {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    auto labels = this->labels;
+    auto changed = this->changed;
+    iterations = 0;
+    changes.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+      }
+    });
+    active.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto active_dev = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          const auto vertex = static_cast<vertex_t>(idx[0]);
+          labels[vertex] = vertex;
+          changed[vertex] = 0;
+          active_dev.insert(vertex);
+        });
+      });
+    });
+  }
+
+  /**
+   * @brief Computes the next label of the queued work-group vertices, a work-group per vertex.
+   *
+   * The group copies the labels of the neighbors next to each other and sorts them with a bitonic network. The network
+   * is padded to a power of two with virtual labels larger than all the others, which never move, so their comparisons
+   * are skipped. Every work-item then measures the runs of equal labels that start at its positions, by binary search
+   * of their ends, and group reductions pick the longest one.
+   */
+  sycl::event launchGroupMode() {
+    sycl::queue& queue = G.getQueue();
+    uint32_t count = 0;
+    queue.copy(group_count, &count, 1).wait();
+    if (count == 0) { return {}; }
+
+    auto graph_dev = G.getDeviceGraph();
+    auto labels = this->labels;
+    auto next_labels = this->next_labels;
+    auto sorted = this->sorted;
+    auto group_vertices = this->group_vertices;
+    const size_t local_size = sygraph::device::getProfile(queue).compute_unit_size;
+    return queue.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::nd_range<1>{count * local_size, local_size}, [=](sycl::nd_item<1> item) {
+        auto group = item.get_group();
+        const size_t lid = item.get_local_linear_id();
+        const vertex_t vertex = group_vertices[item.get_group_linear_id()];
+        const size_t degree = graph_dev.getDegree(vertex);
+        const auto begin = graph_dev.begin(vertex);
+        vertex_t* segment = sorted + graph_dev.getFirstNeighbor(vertex);
+
+        for (size_t i = lid; i < degree; i += local_size) { segment[i] = labels[*(begin + i)]; }
+        sycl::group_barrier(group);
+
+        // every comparator puts the smaller label first: the first step of a stage mirrors the blocks, the next ones halve them
+        const size_t padded = std::bit_ceil(degree);
+        for (size_t block = 2; block <= padded; block *= 2) {
+          for (size_t stride = block / 2; stride > 0; stride /= 2) {
+            for (size_t i = lid; i < padded; i += local_size) {
+              const size_t partner = stride == block / 2 ? i ^ (block - 1) : i ^ stride;
+              if (partner > i && partner < degree && segment[partner] < segment[i]) { std::swap(segment[i], segment[partner]); }
+            }
+            sycl::group_barrier(group);
+          }
+        }
+
+        const vertex_t own = labels[vertex];
+        size_t best_count = 0;
+        size_t own_count = 0;
+        vertex_t best = own;
+        for (size_t i = lid; i < degree; i += local_size) {
+          if (i > 0 && segment[i] == segment[i - 1]) { continue; }
+          size_t low = i + 1;
+          size_t high = degree;
+          while (low < high) {
+            const size_t mid = low + ((high - low) / 2);
+            if (segment[mid] == segment[i]) {
+              low = mid + 1;
+            } else {
+              high = mid;
+            }
+          }
+          // the runs of a work-item come in increasing label order, so a tie keeps the smaller label
+          if (low - i > best_count) {
+            best_count = low - i;
+            best = segment[i];
+          }
+          if (segment[i] == own) { own_count = low - i; }
+        }
+        const size_t group_best = sycl::reduce_over_group(group, best_count, sycl::maximum<size_t>());
+        best = sycl::reduce_over_group(group, best_count == group_best ? best : static_cast<vertex_t>(-1), sycl::minimum<vertex_t>());
+        own_count = sycl::reduce_over_group(group, own_count, sycl::maximum<size_t>());
+        if (group.leader()) { next_labels[vertex] = own_count == group_best ? own : best; }
+      });
+    });
+  }
+
+  ~LabelPropagationInstance() {
+    sycl::queue& queue = G.getQueue();
+    memory::detail::releaseUSM(labels, queue);
+    memory::detail::releaseUSM(next_labels, queue);
+    memory::detail::releaseUSM(changed, queue);
+    memory::detail::releaseUSM(sorted, queue);
+    memory::detail::releaseUSM(group_vertices, queue);
+    memory::detail::releaseUSM(group_count, queue);
+  }
+};
+} // namespace detail
+
+
+/**
+ * @class LabelPropagation
+ * @brief Detects communities by label propagation: every vertex adopts the most frequent label among its neighbors.
+ *
+ * Every vertex starts with its own id as label. A vertex keeps its label when it is among the most frequent ones, and
+ * otherwise takes the smallest of the most frequent ones, so the result is deterministic. Only the neighbors of the
+ * vertices that changed label at an iteration are active at the next one, so the later iterations only touch the
+ * regions that have not settled yet.
+ *
+ * @tparam GraphType The type of the graph on which the communities are detected.
+ */
+template<typename GraphType>
+class LabelPropagation {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+
+public:
+  LabelPropagation(GraphType& g) : _g(g) {};
+
+  /**
+   * @brief Initializes the propagation.
+   *
+   * The instance holding labels and frontiers is created on the first call only; later calls reset it in place
+   * without allocating memory.
+   */
+  void init() {
+    if (!_instance) { _instance = std::make_unique<detail::LabelPropagationInstance<GraphType>>(_g); }
+    _instance->reset();
+  }
+
+  /**
+   * @brief Resets the internal state of the instance.
+   *
+   * This function destroys the internal instance, releasing its buffers.
+   */
+  void reset() { _instance.reset(); }
+
+  /**
+   * @brief Sets how the vertices of an iteration see the labels of the others, `lpa_mode::semi_synchronous` by default.
+   *
+   * Synchronous updates may oscillate forever between two labelings, for example on bipartite regions, and then stop
+   * at the maximum number of iterations. Semi-synchronous updates break most of these oscillations.
+   */
+  void setMode(lpa_mode mode) { _mode = mode; }
+
+  /**
+   * @brief Sets the largest number of iterations, 100 by default.
+   */
+  void setMaxIterations(size_t max_iterations) { _max_iterations = max_iterations; }
+
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
+  /**
+   * @brief Runs the propagation until no label changes, or the maximum number of iterations is reached.
+   *
+   * Every iteration, or every half of it in the semi-synchronous mode, performs the following steps:
+   * 1. A work-item per active vertex computes the most frequent neighbor label of the vertices of small degree by
+   *    counting, and queues the others.
+   * 2. A work-group per queued vertex sorts its neighbor labels and finds their most frequent one.
+   * 3. The new labels are applied, and `filter::external` collects the vertices that changed.
+   * 4. An advance from them activates their neighbors for the next iteration; in the semi-synchronous mode, the
+   *    neighbors of the vertices changed by the first half are also activated for the second one.
+   *
+   * @throws std::runtime_error if the instance is not initialized.
+   */
+  template<bool EnableProfiling = false>
+  void run() {
+    if (!_instance) { throw std::runtime_error("LabelPropagation instance not initialized"); }
+
+    auto& G = _instance->G;
+    sycl::queue& queue = G.getQueue();
+    auto graph_dev = G.getDeviceGraph();
+    auto labels = _instance->labels;
+    auto next_labels = _instance->next_labels;
+    auto changed = _instance->changed;
+    auto group_vertices = _instance->group_vertices;
+    auto group_count = _instance->group_count;
+    const size_t halves = _mode == lpa_mode::synchronous ? 1 : 2;
+    auto lb = _load_balancer.value_or(sygraph::tuning::getProfile().load_balancer);
+    _instance->active.visit([&](auto& active) {
+      _instance->changes.visit([&](auto& changes) {
+        // both pairs are created for the same queue, hence with the same bitmap word
+        if constexpr (std::is_same_v<std::decay_t<decltype(active)>, std::decay_t<decltype(changes)>>) {
+          using load_balance_t = sygraph::operators::load_balancer;
+          using frontier_view_t = sygraph::frontier::frontier_view;
+
+          _instance->ready.wait_and_throw();
+          _instance->dirty = true;
+
+          while (_instance->iterations < _max_iterations && !active.in.empty()) {
+            bool any_changed = false;
+            for (size_t half = 0; half < halves; half++) {
+              const bool all = halves == 1;
+              queue.fill(group_count, 0U, 1).wait();
+              auto e1 = sygraph::operators::compute::execute<frontier_view_t::vertex>(G, active.in, [=](auto v) {
+                const auto vertex = static_cast<vertex_t>(v);
+                if (!all && vertex % 2 != half) { return; }
+                const size_t degree = graph_dev.getDegree(vertex);
+                if (degree > detail::LabelPropagationInstance<GraphType>::work_item_degree) {
+                  group_vertices[sygraph::sync::atomicFetchAdd(group_count, 1U)] = vertex;
+                  return;
+                }
+                const auto begin = graph_dev.begin(vertex);
+                const vertex_t own = labels[vertex];
+                size_t best_count = 0;
+                size_t own_count = 0;
+                vertex_t best = own;
+                for (size_t i = 0; i < degree; i++) {
+                  const vertex_t label = labels[*(begin + i)];
+                  size_t count = 0;
+                  for (size_t j = 0; j < degree; j++) { count += labels[*(begin + j)] == label ? 1 : 0; }
+                  if (count > best_count || (count == best_count && label < best)) {
+                    best_count = count;
+                    best = label;
+                  }
+                  if (label == own) { own_count = count; }
+                }
+                next_labels[vertex] = own_count == best_count ? own : best;
+              });
+              e1.waitAndThrow();
+              auto e2 = _instance->launchGroupMode();
+              e2.wait_and_throw();
+
+              auto e3 = sygraph::operators::compute::execute<frontier_view_t::vertex>(G, active.in, [=](auto v) {
+                if (!all && v % 2 != half) { return; }
+                if (next_labels[v] != labels[v]) {
+                  labels[v] = next_labels[v];
+                  changed[v] = 1;
+                }
+              });
+              e3.waitAndThrow();
+              auto e4 = sygraph::operators::filter::external(G, active.in, changes.in, [=](auto vertex) { return changed[vertex] != 0; });
+              e4.waitAndThrow();
+#ifdef ENABLE_PROFILING
+              sygraph::Profiler::addEvent(e1, "work_item_mode");
+              sygraph::Profiler::addEvent(e2, "work_group_mode");
+              sygraph::Profiler::addEvent(e3, "apply");
+              sygraph::Profiler::addEvent(e4, "filter");
+#endif
+              if (changes.in.empty()) { continue; }
+              any_changed = true;
+
+              auto e5 = sygraph::operators::compute::execute<frontier_view_t::vertex>(G, changes.in, [=](auto vertex) { changed[vertex] = 0; });
+              e5.waitAndThrow();
+              // the second half must also see the labels changed by the first one
+              const bool activate_now = half + 1 < halves;
+              auto active_dev = active.in.getDeviceFrontier();
+              auto activate = [=](auto src, auto dst, auto edge, auto weight) -> bool {
+                if (activate_now) { active_dev.insert(dst); }
+                return true;
+              };
+              auto e6 = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+                return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+                    G, changes.in, active.out, activate);
+              });
+              e6.waitAndThrow();
+#ifdef ENABLE_PROFILING
+              sygraph::Profiler::addEvent(e6, "advance");
+#endif
+            }
+            _instance->iterations++;
+            if (!any_changed) { break; }
+
+            sygraph::frontier::swap(active.in, active.out);
+            active.out.clear();
+          }
+        }
+      });
+    });
+  }
+
+  /**
+   * @brief Returns the label of a vertex, the id of a vertex of its community.
+   */
+  vertex_t getLabel(size_t vertex) const {
+    if (!_instance) { throw std::runtime_error("LabelPropagation instance not initialized"); }
+    vertex_t value = 0;
+    _g.getQueue().copy(_instance->labels + vertex, &value, 1).wait();
+    return value;
+  }
+
+  /**
+   * @brief Returns the labels of all vertices, in device memory.
+   */
+  const vertex_t* getLabels() const {
+    if (!_instance) { throw std::runtime_error("LabelPropagation instance not initialized"); }
+    return _instance->labels;
+  }
+
+  /**
+   * @brief Returns the number of iterations run.
+   */
+  size_t getIterationCount() const {
+    if (!_instance) { throw std::runtime_error("LabelPropagation instance not initialized"); }
+    return _instance->iterations;
+  }
+
+private:
+  GraphType& _g;
+  std::unique_ptr<detail::LabelPropagationInstance<GraphType>> _instance;
+  lpa_mode _mode = lpa_mode::semi_synchronous;
+  size_t _max_iterations = 100;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
+};
+
+} // namespace algorithms
+} // namespace sygraph
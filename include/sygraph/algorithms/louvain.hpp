@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include <sygraph/graph/build.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/spgemm/impl_spgemm.hpp>
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/memory.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+#include <sygraph/utils/scan.hpp>
+#include <sygraph/utils/sort.hpp>
+
+
+namespace sygraph {
+namespace algorithms {
+namespace detail {
+
+// The device buffers of a level, indexed by the vertices of the level graph or by its communities.
+template<typename VertexT>
+struct LouvainLevelBuffers {
+  VertexT* community;       // the community of every vertex
+  VertexT* target;          // the community every vertex moves to at the end of an iteration
+  float* vertex_weights;    // the weighted degree of every vertex
+  float* community_weights; // the sum of the weighted degrees of the vertices of every community
+  uint32_t* community_sizes;
+  size_t* spill_offsets;    // the hash tables of the vertices too large for local memory, back to back
+  VertexT* spill_keys;
+  float* spill_links;
+};
+
+template<typename GraphType>
+struct LouvainInstance {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using level_graph_t = graph::detail::GraphCSR<memory::space::device, vertex_t, edge_t, float>;
+  static constexpr vertex_t empty_slot = static_cast<vertex_t>(-1);
+
+  GraphType& G;
+  vertex_t* assignment; // the community of every vertex of G
+  LouvainLevelBuffers<vertex_t> buffers;
+  vertex_t* renumber;   // the dense id of every non-empty community, as an exclusive scan
+  float* sums;          // the two sums of the modularity reduction
+  uint32_t* moves;      // the number of vertices that moved in an iteration
+
+  std::unique_ptr<level_graph_t> level_graph; // the graph of the communities found at the previous level
+  float total_weight = 0.0f;                  // twice the total edge weight, the same at every level
+  float modularity = 0.0f;
+  size_t community_count = 0;
+  size_t level_count = 0;
+  sycl::event ready;
+
+  LouvainInstance(GraphType& G) : G(G) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    assignment = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    buffers.community = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    buffers.target = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    buffers.vertex_weights = memory::detail::memoryAlloc<float, memory::space::device>(size, queue);
+    buffers.community_weights = memory::detail::memoryAlloc<float, memory::space::device>(size, queue);
+    buffers.community_sizes = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+    buffers.spill_offsets = memory::detail::memoryAlloc<size_t, memory::space::device>(size + 1, queue);
+    renumber = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size + 1, queue);
+    sums = memory::detail::memoryAlloc<float, memory::space::device>(2, queue);
+    moves = memory::detail::memoryAlloc<uint32_t, memory::space::device>(1, queue);
+  }
+
+  /**
+   * @brief Puts every vertex in its own community.
+   */
+  void reset() {
+    sycl::queue& queue = G.getQueue();
+    auto assignment = this->assignment;
+    level_graph.reset();
+    modularity = 0.0f;
+    community_count = G.getVertexCount();
+    level_count = 0;
+    ready = queue.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::range<1>(G.getVertexCount()), [=](sycl::id<1> idx) { assignment[idx[0]] = static_cast<vertex_t>(idx[0]); });
+    });
+  }
+
+  /**
+   * @brief Computes the modularity of the communities of a level.
+   *
+   * The first sum is the weight of the edges within communities, self-loops of the contracted levels included, and the
+   * second one the sum of the squared community weights.
+   */
+  template<typename LevelGraphT>
+  float computeModularity(LevelGraphT& g) {
+    sycl::queue& queue = G.getQueue();
+    auto graph_dev = g.getDeviceGraph();
+    auto b = buffers;
+    auto sums = this->sums;
+    queue.fill(sums, 0.0f, 2).wait();
+    auto e = queue.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::range<1>(g.getVertexCount()),
+                       sycl::reduction(sums, 0.0f, sycl::plus<float>()),
+                       sycl::reduction(sums + 1, 0.0f, sycl::plus<float>()),
+                       [=](sycl::id<1> idx, auto& internal, auto& squares) {
+                         const auto vertex = static_cast<vertex_t>(idx[0]);
+                         const vertex_t own = b.community[vertex];
+                         float links = 0.0f;
+                         for (auto it = graph_dev.begin(vertex); it != graph_dev.end(vertex); ++it) {
+                           if (b.community[*it] == own) { links += static_cast<float>(graph_dev.getEdgeWeight(it.getIndex())); }
+                         }
+                         internal += links;
+                         squares += b.community_weights[vertex] * b.community_weights[vertex];
+                       });
+    });
+    e.wait_and_throw();
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addEvent(e, "modularity");
+#endif
+    float host_sums[2];
+    queue.copy(sums, host_sums, 2).wait();
+    return (host_sums[0] / total_weight) - (host_sums[1] / (total_weight * total_weight));
+  }
+
+  /**
+   * @brief Sums the weighted degrees of the vertices of every community, and counts them.
+   */
+  template<typename LevelGraphT>
+  void updateCommunityWeights(LevelGraphT& g) {
+    sycl::queue& queue = G.getQueue();
+    const size_t size = g.getVertexCount();
+    auto b = buffers;
+    auto e1 = queue.fill(b.community_weights, 0.0f, size);
+    auto e2 = queue.fill(b.community_sizes, 0U, size);
+    e1.wait();
+    e2.wait();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+         const vertex_t own = b.community[idx[0]];
+         sygraph::sync::atomicCombine(b.community_weights + own, b.vertex_weights[idx[0]], sycl::plus<float>());
+         sygraph::sync::atomicFetchAdd(b.community_sizes + own, 1U);
+       });
+     }).wait_and_throw();
+  }
+
+  /**
+   * @brief Runs the local-moving phase on a level graph, then contracts its communities into the next level graph.
+   *
+   * @return Whether the level merged some vertices, so that another level can improve the modularity further.
+   */
+  template<typename LevelGraphT>
+  bool runLevel(LevelGraphT& g, float threshold, size_t max_iterations) {
+    sycl::queue& queue = G.getQueue();
+    const size_t size = g.getVertexCount();
+    auto graph_dev = g.getDeviceGraph();
+    auto b = buffers;
+
+    // every vertex starts in its own community
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+         const auto vertex = static_cast<vertex_t>(idx[0]);
+         float weight = 0.0f;
+         for (auto it = graph_dev.begin(vertex); it != graph_dev.end(vertex); ++it) {
+           weight += static_cast<float>(graph_dev.getEdgeWeight(it.getIndex()));
+         }
+         b.community[vertex] = vertex;
+         b.vertex_weights[vertex] = weight;
+       });
+     }).wait_and_throw();
+    updateCommunityWeights(g);
+    if (level_count == 0) {
+      auto sums = this->sums;
+      queue.fill(sums, 0.0f, 1).wait();
+      queue.submit([&](sycl::handler& cgh) {
+         cgh.parallel_for(sycl::range<1>(size), sycl::reduction(sums, 0.0f, sycl::plus<float>()), [=](sycl::id<1> idx, auto& total) {
+           total += b.vertex_weights[idx[0]];
+         });
+       }).wait_and_throw();
+      queue.copy(sums, &total_weight, 1).wait();
+    }
+    level_count++;
+    if (!(total_weight > 0.0f)) { return false; }
+
+    // every vertex hashes its neighbor communities into a table of twice its degree, in local memory when it fits it
+    // and in global memory otherwise
+    const auto& profile = sygraph::device::getProfile(queue);
+    const size_t local_size = profile.compute_unit_size;
+    const size_t local_table_size =
+        std::bit_floor(std::max<size_t>(2, std::min(16 * local_size, profile.local_mem_size / (2 * (sizeof(vertex_t) + sizeof(float))))));
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+         const size_t table_size = std::bit_ceil(std::max<size_t>(1, 2 * graph_dev.getDegree(static_cast<vertex_t>(idx[0]))));
+         b.spill_offsets[idx[0]] = table_size > local_table_size ? table_size : 0;
+       });
+     }).wait_and_throw();
+    sygraph::scan::exclusiveSum(queue, b.spill_offsets, b.spill_offsets, size);
+    size_t spill_size = 0;
+    queue.copy(b.spill_offsets + size, &spill_size, 1).wait();
+    b.spill_keys = memory::detail::memoryAlloc<vertex_t, memory::space::device>(std::max<size_t>(1, spill_size), queue);
+    b.spill_links = memory::detail::memoryAlloc<float, memory::space::device>(std::max<size_t>(1, spill_size), queue);
+
+    const float m2 = total_weight;
+    float current = computeModularity(g);
+    bool merged = false;
+    for (size_t iteration = 0; iteration < max_iterations; iteration++) {
+      // every vertex picks the neighbor community of largest modularity gain, all from the same snapshot
+      auto e1 = queue.submit([&](sycl::handler& cgh) {
+        sycl::local_accessor<vertex_t, 1> local_keys{local_table_size, cgh};
+        sycl::local_accessor<float, 1> local_links{local_table_size, cgh};
+        cgh.parallel_for(sycl::nd_range<1>{size * local_size, local_size}, [=](sycl::nd_item<1> item) {
+          auto group = item.get_group();
+          const auto vertex = static_cast<vertex_t>(item.get_group_linear_id());
+          const size_t lid = item.get_local_linear_id();
+          const vertex_t own = b.community[vertex];
+          const size_t degree = graph_dev.getDegree(vertex);
+          const size_t spill_begin = b.spill_offsets[vertex];
+          const bool spilled = b.spill_offsets[vertex + 1] > spill_begin;
+          const size_t table_size = std::bit_ceil(std::max<size_t>(1, 2 * degree));
+          vertex_t* keys = spilled ? b.spill_keys + spill_begin : &local_keys[0];
+          float* links = spilled ? b.spill_links + spill_begin : &local_links[0];
+
+          for (size_t slot = lid; slot < table_size; slot += local_size) {
+            keys[slot] = empty_slot;
+            links[slot] = 0.0f;
+          }
+          sycl::group_barrier(group);
+
+          const auto begin = graph_dev.begin(vertex);
+          for (size_t i = lid; i < degree; i += local_size) {
+            const vertex_t neighbor = *(begin + i);
+            if (neighbor == vertex) { continue; }
+            const vertex_t key = b.community[neighbor];
+            const float weight = static_cast<float>(graph_dev.getEdgeWeight((begin + i).getIndex()));
+            for (size_t slot = sygraph::operators::spgemm::detail::hashSlot(key, table_size);; slot = (slot + 1) & (table_size - 1)) {
+              sycl::atomic_ref<vertex_t, sycl::memory_order::relaxed, sycl::memory_scope::work_group> entry{keys[slot]};
+              vertex_t expected = empty_slot;
+              entry.compare_exchange_strong(expected, key);
+              if (expected == empty_slot || expected == key) {
+                sycl::atomic_ref<float, sycl::memory_order::relaxed, sycl::memory_scope::work_group>{links[slot]}.fetch_add(weight);
+                break;
+              }
+            }
+          }
+          sycl::group_barrier(group);
+
+          // the gains are scaled by m2 / 2, which does not change their order
+          const float vertex_weight = b.vertex_weights[vertex];
+          float own_links = 0.0f;
+          float best_gain = std::numeric_limits<float>::lowest();
+          vertex_t best = empty_slot;
+          for (size_t slot = lid; slot < table_size; slot += local_size) {
+            const vertex_t key = keys[slot];
+            if (key == empty_slot) { continue; }
+            if (key == own) {
+              own_links = links[slot];
+              continue;
+            }
+            const float gain = links[slot] - (vertex_weight * b.community_weights[key] / m2);
+            if (gain > best_gain || (gain == best_gain && key < best)) {
+              best_gain = gain;
+              best = key;
+            }
+          }
+          own_links = sycl::reduce_over_group(group, own_links, sycl::plus<float>());
+          const float group_gain = sycl::reduce_over_group(group, best_gain, sycl::maximum<float>());
+          best = sycl::reduce_over_group(group, best_gain == group_gain ? best : empty_slot, sycl::minimum<vertex_t>());
+
+          if (lid == 0) {
+            const float stay_gain = own_links - (vertex_weight * (b.community_weights[own] - vertex_weight) / m2);
+            vertex_t next = own;
+            // two singletons would swap forever, so a singleton only joins another one of smaller id
+            if (best != empty_slot && group_gain > stay_gain && !(b.community_sizes[own] == 1 && b.community_sizes[best] == 1 && best > own)) {
+              next = best;
+            }
+            b.target[vertex] = next;
+          }
+        });
+      });
+      e1.wait_and_throw();
+
+      auto moves = this->moves;
+      queue.fill(moves, 0U, 1).wait();
+      auto e2 = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), sycl::reduction(moves, 0U, sycl::plus<uint32_t>()), [=](sycl::id<1> idx, auto& moved) {
+          // the previous community is kept in the target, to undo the moves if they lower the modularity
+          const vertex_t previous = b.community[idx[0]];
+          if (b.target[idx[0]] != previous) {
+            b.community[idx[0]] = b.target[idx[0]];
+            b.target[idx[0]] = previous;
+            moved += 1U;
+          }
+        });
+      });
+      e2.wait_and_throw();
+#ifdef ENABLE_PROFILING
+      sygraph::Profiler::addEvent(e1, "local_moving");
+      sygraph::Profiler::addEvent(e2, "apply_moves");
+#endif
+      uint32_t moved = 0;
+      queue.copy(moves, &moved, 1).wait();
+      if (moved == 0) { break; }
+
+      updateCommunityWeights(g);
+      const float next = computeModularity(g);
+      const float improvement = next - current;
+      if (improvement < 0.0f) {
+        // the simultaneous moves lowered the modularity, so the level keeps the previous communities
+        queue.copy(b.target, b.community, size).wait();
+        updateCommunityWeights(g);
+        break;
+      }
+      merged = true;
+      current = next;
+      if (improvement < threshold) { break; }
+    }
+    modularity = current;
+    memory::detail::releaseUSM(b.spill_keys, queue);
+    memory::detail::releaseUSM(b.spill_links, queue);
+
+    if (!merged) { return false; }
+    const size_t count = contract(g);
+    const bool shrunk = count < size;
+    community_count = count;
+    return shrunk;
+  }
+
+  /**
+   * @brief Contracts the communities of a level graph into the next level graph, and maps the vertices of G to them.
+   *
+   * The non-empty communities are renumbered by a scan, and their vertices are grouped by a counting sort. Every
+   * community then gets a hash table of twice the total degree of its vertices, which a work-group fills with the
+   * weights towards the neighbor communities, as in `spgemm`: the edges within a community add up to a self-loop.
+   *
+   * @return The number of communities.
+   */
+  template<typename LevelGraphT>
+  size_t contract(LevelGraphT& g) {
+    sycl::queue& queue = G.getQueue();
+    const size_t size = g.getVertexCount();
+    auto graph_dev = g.getDeviceGraph();
+    auto b = buffers;
+    auto renumber = this->renumber;
+    auto assignment = this->assignment;
+
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) { renumber[idx[0]] = b.community_sizes[idx[0]] > 0 ? 1 : 0; });
+     }).wait_and_throw();
+    sygraph::scan::exclusiveSum(queue, renumber, renumber, size);
+    vertex_t count = 0;
+    queue.copy(renumber + size, &count, 1).wait();
+
+    edge_t* member_offsets = memory::detail::memoryAlloc<edge_t, memory::space::device>(count + 1, queue);
+    uint32_t* cursors = memory::detail::memoryAlloc<uint32_t, memory::space::device>(std::max<size_t>(1, count), queue);
+    vertex_t* members = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    queue.fill(cursors, 0U, count).wait();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(G.getVertexCount()), [=](sycl::id<1> idx) { assignment[idx[0]] = renumber[b.community[assignment[idx[0]]]]; });
+     }).wait_and_throw();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+         if (b.community_sizes[idx[0]] > 0) { member_offsets[renumber[idx[0]]] = b.community_sizes[idx[0]]; }
+       });
+     }).wait_and_throw();
+    sygraph::scan::exclusiveSum(queue, member_offsets, member_offsets, count);
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+         const vertex_t next = renumber[b.community[idx[0]]];
+         members[member_offsets[next] + sygraph::sync::atomicFetchAdd(cursors + next, 1U)] = static_cast<vertex_t>(idx[0]);
+       });
+     }).wait_and_throw();
+
+    // the tables of all communities are stored back to back, at the offsets given by a scan of their sizes
+    size_t* table_offsets = memory::detail::memoryAlloc<size_t, memory::space::device>(count + 1, queue);
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
+         size_t bound = 0;
+         for (edge_t m = member_offsets[idx[0]]; m < member_offsets[idx[0] + 1]; m++) { bound += graph_dev.getDegree(members[m]); }
+         table_offsets[idx[0]] = bound == 0 ? 0 : std::bit_ceil(2 * bound);
+       });
+     }).wait_and_throw();
+    sygraph::scan::exclusiveSum(queue, table_offsets, table_offsets, count);
+    size_t total_slots = 0;
+    queue.copy(table_offsets + count, &total_slots, 1).wait();
+
+    vertex_t* keys = memory::detail::memoryAlloc<vertex_t, memory::space::device>(std::max<size_t>(1, total_slots), queue);
+    float* weights = memory::detail::memoryAlloc<float, memory::space::device>(std::max<size_t>(1, total_slots), queue);
+    edge_t* row_counts = memory::detail::memoryAlloc<edge_t, memory::space::device>(count + 1, queue);
+    auto e1 = queue.fill(keys, empty_slot, total_slots);
+    auto e2 = queue.fill(weights, 0.0f, total_slots);
+    auto e3 = queue.fill(row_counts, edge_t{0}, count + 1);
+    e1.wait();
+    e2.wait();
+    e3.wait();
+
+    const size_t local_size = sygraph::device::getProfile(queue).compute_unit_size;
+    auto e4 = queue.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::nd_range<1>{count * local_size, local_size}, [=](sycl::nd_item<1> item) {
+        const size_t row = item.get_group_linear_id();
+        const size_t table_size = table_offsets[row + 1] - table_offsets[row];
+        if (table_size == 0) { return; }
+        vertex_t* row_keys = keys + table_offsets[row];
+        float* row_weights = weights + table_offsets[row];
+        sycl::atomic_ref<edge_t, sycl::memory_order::relaxed, sycl::memory_scope::device> row_count{row_counts[row]};
+
+        for (edge_t m = member_offsets[row]; m < member_offsets[row + 1]; m++) {
+          const auto begin = graph_dev.begin(members[m]);
+          const size_t degree = graph_dev.getDegree(members[m]);
+          for (size_t i = item.get_local_linear_id(); i < degree; i += item.get_local_range(0)) {
+            const vertex_t key = renumber[b.community[*(begin + i)]];
+            const float weight = static_cast<float>(graph_dev.getEdgeWeight((begin + i).getIndex()));
+            for (size_t slot = sygraph::operators::spgemm::detail::hashSlot(key, table_size);; slot = (slot + 1) & (table_size - 1)) {
+              sycl::atomic_ref<vertex_t, sycl::memory_order::relaxed, sycl::memory_scope::device> entry{row_keys[slot]};
+              vertex_t expected = empty_slot;
+              if (entry.compare_exchange_strong(expected, key)) { row_count.fetch_add(edge_t{1}); }
+              if (expected == empty_slot || expected == key) {
+                sygraph::sync::atomicCombine(row_weights + slot, weight, sycl::plus<float>());
+                break;
+              }
+            }
+          }
+        }
+      });
+    });
+    e4.wait_and_throw();
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addEvent(e4, "aggregation");
+#endif
+
+    edge_t* row_offsets = memory::detail::memoryAlloc<edge_t, memory::space::device>(count + 1, queue);
+    sygraph::scan::exclusiveSum(queue, row_counts, row_offsets, count);
+    edge_t nnz = 0;
+    queue.copy(row_offsets + count, &nnz, 1).wait();
+
+    vertex_t* column_indices = memory::detail::memoryAlloc<vertex_t, memory::space::device>(nnz, queue);
+    float* values = memory::detail::memoryAlloc<float, memory::space::device>(nnz, queue);
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
+         const size_t row = idx[0];
+         size_t cursor = row_offsets[row];
+         for (size_t slot = table_offsets[row]; slot < table_offsets[row + 1]; slot++) {
+           if (keys[slot] == empty_slot) { continue; }
+           column_indices[cursor] = keys[slot];
+           values[cursor] = weights[slot];
+           cursor++;
+         }
+         sygraph::sort::sortByKey(column_indices + row_offsets[row], values + row_offsets[row], cursor - row_offsets[row]);
+       });
+     }).wait_and_throw();
+
+    memory::detail::releaseUSM(member_offsets, queue);
+    memory::detail::releaseUSM(cursors, queue);
+    memory::detail::releaseUSM(members, queue);
+    memory::detail::releaseUSM(table_offsets, queue);
+    memory::detail::releaseUSM(keys, queue);
+    memory::detail::releaseUSM(weights, queue);
+    memory::detail::releaseUSM(row_counts, queue);
+
+    graph::Properties properties;
+    properties.weighted = true;
+    level_graph = std::make_unique<level_graph_t>(
+        graph::build::fromDeviceCSR<memory::space::device>(queue, count, row_offsets, column_indices, values, properties));
+    return count;
+  }
+
+  ~LouvainInstance() {
+    sycl::queue& queue = G.getQueue();
+    memory::detail::releaseUSM(assignment, queue);
+    memory::detail::releaseUSM(buffers.community, queue);
+    memory::detail::releaseUSM(buffers.target, queue);
+    memory::detail::releaseUSM(buffers.vertex_weights, queue);
+    memory::detail::releaseUSM(buffers.community_weights, queue);
+    memory::detail::releaseUSM(buffers.community_sizes, queue);
+    memory::detail::releaseUSM(buffers.spill_offsets, queue);
+    memory::detail::releaseUSM(renumber, queue);
+    memory::detail::releaseUSM(sums, queue);
+    memory::detail::releaseUSM(moves, queue);
+  }
+};
+} // namespace detail
+
+
+/**
+ * @class Louvain
+ * @brief Detects the communities of an undirected graph by maximizing their modularity with the Louvain method.
+ *
+ * Every level runs a local-moving phase on the current graph, then contracts its communities into the vertices of a
+ * new weighted `GraphCSR` built on the device, which the next level starts from. The levels stop when a local-moving
+ * phase merges no vertices. Edge weights are used when the graph has them.
+ *
+ * @tparam GraphType The type of the graph on which the communities are detected.
+ */
+template<typename GraphType>
+class Louvain {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+
+public:
+  Louvain(GraphType& g) : _g(g) {};
+
+  /**
+   * @brief Initializes the detection, with every vertex in its own community.
+   *
+   * The instance holding the buffers is created on the first call only; later calls reset it in place.
+   *
+   * @throws std::runtime_error if the graph is directed.
+   */
+  void init() {
+    if (_g.getProperties().directed) { throw std::runtime_error("Louvain: the graph must be undirected"); }
+    if (!_instance) { _instance = std::make_unique<detail::LouvainInstance<GraphType>>(_g); }
+    _instance->reset();
+  }
+
+  /**
+   * @brief Resets the internal state of the instance.
+   *
+   * This function destroys the internal instance, releasing its buffers and level graphs.
+   */
+  void reset() { _instance.reset(); }
+
+  /**
+   * @brief Sets the smallest modularity improvement for which a local-moving phase keeps iterating, 1e-6 by default.
+   */
+  void setThreshold(float threshold) { _threshold = threshold; }
+
+  /**
+   * @brief Sets the largest number of iterations of a local-moving phase, 100 by default.
+   */
+  void setMaxIterations(size_t max_iterations) { _max_iterations = max_iterations; }
+
+  /**
+   * @brief Runs the detection.
+   *
+   * Every iteration of the local-moving phase performs the following steps:
+   * 1. A work-group per vertex sums the weights of its edges towards every neighbor community in a hash table in local
+   *    memory, or in global memory for the vertices of too large a degree.
+   * 2. The work-items compute the modularity gain of the communities in their slots, and a group reduction picks the
+   *    best one, which the vertex moves to if it beats staying.
+   * 3. All moves are applied at once, without coloring the graph; a singleton only joins another singleton of smaller
+   *    id, so that two of them cannot swap communities forever.
+   * 4. The community weights and the modularity are recomputed, and the phase stops when no vertex moves or the
+   *    modularity improves by less than the threshold.
+   *
+   * @throws std::runtime_error if the instance is not initialized.
+   */
+  template<bool EnableProfiling = false>
+  void run() {
+    if (!_instance) { throw std::runtime_error("Louvain instance not initialized"); }
+
+    _instance->ready.wait_and_throw();
+    bool next_level = _instance->runLevel(_instance->G, _threshold, _max_iterations);
+    while (next_level) { next_level = _instance->runLevel(*_instance->level_graph, _threshold, _max_iterations); }
+  }
+
+  /**
+   * @brief Returns the community of a vertex. Communities are numbered from 0 to `getCommunityCount() - 1`.
+   */
+  vertex_t getCommunity(size_t vertex) const {
+    if (!_instance) { throw std::runtime_error("Louvain instance not initialized"); }
+    vertex_t value = 0;
+    _g.getQueue().copy(_instance->assignment + vertex, &value, 1).wait();
+    return value;
+  }
+
+  /**
+   * @brief Returns the communities of all vertices, in device memory.
+   */
+  const vertex_t* getCommunities() const {
+    if (!_instance) { throw std::runtime_error("Louvain instance not initialized"); }
+    return _instance->assignment;
+  }
+
+  /**
+   * @brief Returns the number of communities.
+   */
+  size_t getCommunityCount() const {
+    if (!_instance) { throw std::runtime_error("Louvain instance not initialized"); }
+    return _instance->community_count;
+  }
+
+  /**
+   * @brief Returns the modularity of the communities.
+   */
+  float getModularity() const {
+    if (!_instance) { throw std::runtime_error("Louvain instance not initialized"); }
+    return _instance->modularity;
+  }
+
+  /**
+   * @brief Returns the number of levels run, the one of the input graph included.
+   */
+  size_t getLevelCount() const {
+    if (!_instance) { throw std::runtime_error("Louvain instance not initialized"); }
+    return _instance->level_count;
+  }
+
+private:
+  GraphType& _g;
+  std::unique_ptr<detail::LouvainInstance<GraphType>> _instance;
+  float _threshold = 1e-6f;
+  size_t _max_iterations = 100;
+};
+
+} // namespace algorithms
+} // namespace sygraph
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include <sygraph/frontier/frontier.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/advance/advance.hpp>
+#include <sygraph/operators/filter/filter.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/random.hpp>
+#include <sygraph/utils/tuning.hpp>
+
+
+namespace sygraph {
+namespace algorithms {
+namespace detail {
+
+template<typename GraphType>
+struct MatchingInstance {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
+
+  static constexpr vertex_t unmatched = static_cast<vertex_t>(-1);
+
+  GraphType& G;
+  vertex_t* mates;
+  uint64_t* proposals; // the priority of the best edge towards an unmatched neighbor in the high bits, the neighbor in the low ones
+  uint32_t* size;
+  size_t rounds = 0;
+
+  frontiers_t frontiers; // the unmatched vertices that may still be matched at this round and at the next one
+  bool dirty = false;    // set while a run is in progress, the frontiers must be cleared if it did not complete
+  sycl::event ready;
+
+  MatchingInstance(GraphType& G) : G(G), frontiers(G.getQueue(), G.getVertexCount()) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    mates = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
+    proposals = memory::detail::memoryAlloc<uint64_t, memory::space::device>(size, queue);
+    this->size = memory::detail::memoryAlloc<uint32_t, memory::space::device>(1, queue);
+  }
+
+  /**
+   * @brief Leaves every vertex unmatched, and puts all vertices in the frontier, in one kernel.
+   */
+  void reset() {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    auto mates = this->mates;
+    auto proposals = this->proposals;
+    rounds = 0;
+    frontiers.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto in_dev = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          mates[idx[0]] = unmatched;
+          proposals[idx[0]] = 0;
+          in_dev.insert(static_cast<vertex_t>(idx[0]));
+        });
+      });
+    });
+  }
+
+  ~MatchingInstance() {
+    sycl::queue& queue = G.getQueue();
+    memory::detail::releaseUSM(mates, queue);
+    memory::detail::releaseUSM(proposals, queue);
+    memory::detail::releaseUSM(size, queue);
+  }
+};
+} // namespace detail
+
+
+/**
+ * @class Matching
+ * @brief Computes a maximal matching of an undirected graph with random-priority rounds.
+ *
+ * At every round, every edge between unmatched vertices draws a priority from a counter-based generator keyed by the
+ * seed, the round and its two endpoints, so both endpoints see the same priority. Every unmatched vertex proposes to
+ * the neighbor across its edge of highest priority, and two vertices that propose to each other are matched, as the
+ * endpoints of the edge of highest priority of the round do. The matching depends only on the graph and the seed.
+ *
+ * @tparam GraphType The type of the graph on which the matching is computed.
+ */
+template<typename GraphType>
+class Matching {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+
+public:
+  /**
+   * @brief The mate of the vertices left unmatched.
+   */
+  static constexpr vertex_t unmatched = detail::MatchingInstance<GraphType>::unmatched;
+
+  Matching(GraphType& g) : _g(g) {};
+
+  /**
+   * @brief Initializes the computation, with every vertex unmatched.
+   *
+   * The instance holding mates and frontiers is created on the first call only; later calls reset it in place without
+   * allocating memory.
+   *
+   * @throws std::runtime_error if the graph is directed.
+   */
+  void init() {
+    if (_g.getProperties().directed) { throw std::runtime_error("Matching: the graph must be undirected"); }
+    if (!_instance) { _instance = std::make_unique<detail::MatchingInstance<GraphType>>(_g); }
+    _instance->reset();
+  }
+
+  /**
+   * @brief Resets the internal state of the instance.
+   *
+   * This function destroys the internal instance, releasing its buffers.
+   */
+  void reset() { _instance.reset(); }
+
+  /**
+   * @brief Sets the seed of the priorities, 0 by default.
+   */
+  void setSeed(uint64_t seed) { _seed = seed; }
+
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
+  /**
+   * @brief Runs the computation.
+   *
+   * The function performs the following steps while some vertices may still be matched:
+   * 1. An advance over them keeps, for every vertex, the largest proposal towards an unmatched neighbor, the priority
+   *    of the edge in the high 32 bits and the neighbor in the low ones, with an atomic maximum.
+   * 2. `filter::external` keeps the vertices whose proposal is not returned, which clear it for the next round, and
+   *    drops the decided ones: those without unmatched neighbors, and those whose proposal is returned, which are
+   *    matched.
+   *
+   * @throws std::runtime_error if the instance is not initialized.
+   */
+  template<bool EnableProfiling = false>
+  void run() {
+    if (!_instance) { throw std::runtime_error("Matching instance not initialized"); }
+
+    auto& G = _instance->G;
+    auto mates = _instance->mates;
+    auto proposals = _instance->proposals;
+    const uint64_t seed = _seed;
+    auto lb = _load_balancer.value_or(sygraph::tuning::getProfile().load_balancer);
+    _instance->frontiers.visit([&](auto& frontiers) {
+      using load_balance_t = sygraph::operators::load_balancer;
+      using frontier_view_t = sygraph::frontier::frontier_view;
+      auto& in = frontiers.in;
+      auto& out = frontiers.out;
+
+      _instance->ready.wait_and_throw();
+      _instance->dirty = true;
+
+      while (!in.empty()) {
+        const uint64_t round = _instance->rounds;
+        auto propose = [=](auto src, auto dst, auto edge, auto weight) -> bool {
+          if (dst == src || mates[dst] != unmatched) { return false; }
+          const uint64_t low = std::min<uint64_t>(src, dst);
+          const uint64_t high = std::max<uint64_t>(src, dst);
+          // a proposal is never 0, the value of no proposal, since the priority is offset by one
+          const uint64_t priority = (sygraph::random::bits(seed, round, (high << 32) | low) >> 33) + 1;
+          sygraph::sync::atomicCombine(proposals + src, (priority << 32) | static_cast<uint64_t>(dst), sycl::maximum<uint64_t>());
+          return false;
+        };
+        auto e1 = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+          return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(G, in, out, propose);
+        });
+        e1.waitAndThrow();
+
+        // a proposal read while its vertex clears it is either the old one, which is not returned, or no proposal
+        auto e2 = sygraph::operators::filter::external(G, in, out, [=](auto vertex) {
+          const uint64_t proposal = proposals[vertex];
+          if (proposal == 0) { return false; }
+          const auto partner = static_cast<vertex_t>(proposal & 0xFFFFFFFFU);
+          const uint64_t returned = proposals[partner];
+          if (returned != 0 && static_cast<vertex_t>(returned & 0xFFFFFFFFU) == static_cast<vertex_t>(vertex)) {
+            mates[vertex] = partner;
+            return false;
+          }
+          proposals[vertex] = 0;
+          return true;
+        });
+        e2.waitAndThrow();
+#ifdef ENABLE_PROFILING
+        sygraph::Profiler::addEvent(e1, "advance");
+        sygraph::Profiler::addEvent(e2, "filter");
+#endif
+        sygraph::frontier::swap(in, out);
+        _instance->rounds++;
+      }
+    });
+    _instance->dirty = false;
+  }
+
+  /**
+   * @brief Returns the mate of a vertex, or `unmatched`.
+   */
+  vertex_t getMate(size_t vertex) const {
+    if (!_instance) { throw std::runtime_error("Matching instance not initialized"); }
+    vertex_t value = 0;
+    _g.getQueue().copy(_instance->mates + vertex, &value, 1).wait();
+    return value;
+  }
+
+  /**
+   * @brief Returns the mates of all vertices, in device memory.
+   */
+  const vertex_t* getMates() const {
+    if (!_instance) { throw std::runtime_error("Matching instance not initialized"); }
+    return _instance->mates;
+  }
+
+  /**
+   * @brief Returns the number of matched edges.
+   */
+  size_t getSize() const {
+    if (!_instance) { throw std::runtime_error("Matching instance not initialized"); }
+    sycl::queue& queue = _g.getQueue();
+    auto mates = _instance->mates;
+    auto size = _instance->size;
+    queue.fill(size, 0U, 1).wait();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(_g.getVertexCount()), sycl::reduction(size, 0U, sycl::plus<uint32_t>()), [=](sycl::id<1> idx, auto& acc) {
+         acc += mates[idx[0]] != unmatched ? 1U : 0U;
+       });
+     }).wait_and_throw();
+    uint32_t value = 0;
+    queue.copy(size, &value, 1).wait();
+    return value / 2;
+  }
+
+  /**
+   * @brief Returns the number of rounds run.
+   */
+  size_t getRoundCount() const {
+    if (!_instance) { throw std::runtime_error("Matching instance not initialized"); }
+    return _instance->rounds;
+  }
+
+private:
+  GraphType& _g;
+  std::unique_ptr<detail::MatchingInstance<GraphType>> _instance;
+  uint64_t _seed = 0;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
+};
+
+} // namespace algorithms
+} // namespace sygraph
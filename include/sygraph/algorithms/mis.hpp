@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include <sygraph/frontier/frontier.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/advance/advance.hpp>
+#include <sygraph/operators/filter/filter.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/random.hpp>
+#include <sygraph/utils/tuning.hpp>
+
+
+namespace sygraph {
+namespace algorithms {
+namespace detail {
+
+template<typename GraphType>
+struct MISInstance {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
+
+  static constexpr uint32_t beaten = 1;   // a neighbor still undecided has a higher priority
+  static constexpr uint32_t excluded = 2; // a neighbor is in the set
+
+  GraphType& G;
+  uint32_t* members; // 1 for the vertices in the set
+  uint32_t* status;  // why an undecided vertex did not join the set at this round
+  uint32_t* size;
+  size_t rounds = 0;
+
+  frontiers_t frontiers; // the undecided vertices of this round and of the next one
+  bool dirty = false;    // set while a run is in progress, the frontiers must be cleared if it did not complete
+  sycl::event ready;
+
+  MISInstance(GraphType& G) : G(G), frontiers(G.getQueue(), G.getVertexCount()) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    members = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+    status = memory::detail::memoryAlloc<uint32_t, memory::space::device>(size, queue);
+    this->size = memory::detail::memoryAlloc<uint32_t, memory::space::device>(1, queue);
+  }
+
+  /**
+   * @brief Empties the set and makes every vertex undecided, in one kernel.
+   */
+  void reset() {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    auto members = this->members;
+    auto status = this->status;
+    rounds = 0;
+    frontiers.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto in_dev = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          members[idx[0]] = 0;
+          status[idx[0]] = 0;
+          in_dev.insert(static_cast<vertex_t>(idx[0]));
+        });
+      });
+    });
+  }
+
+  ~MISInstance() {
+    sycl::queue& queue = G.getQueue();
+    memory::detail::releaseUSM(members, queue);
+    memory::detail::releaseUSM(status, queue);
+    memory::detail::releaseUSM(size, queue);
+  }
+};
+} // namespace detail
+
+
+/**
+ * @class MIS
+ * @brief Computes a maximal independent set of an undirected graph with Luby's random-priority rounds.
+ *
+ * At every round, every undecided vertex draws a priority from a counter-based generator keyed by the seed, the round
+ * and the vertex, and joins the set when its priority beats those of all its undecided neighbors. The set depends only
+ * on the graph and the seed.
+ *
+ * @tparam GraphType The type of the graph on which the set is computed.
+ */
+template<typename GraphType>
+class MIS {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+
+public:
+  MIS(GraphType& g) : _g(g) {};
+
+  /**
+   * @brief Initializes the computation, with every vertex undecided.
+   *
+   * The instance holding flags and frontiers is created on the first call only; later calls reset it in place without
+   * allocating memory.
+   *
+   * @throws std::runtime_error if the graph is directed.
+   */
+  void init() {
+    if (_g.getProperties().directed) { throw std::runtime_error("MIS: the graph must be undirected"); }
+    if (!_instance) { _instance = std::make_unique<detail::MISInstance<GraphType>>(_g); }
+    _instance->reset();
+  }
+
+  /**
+   * @brief Resets the internal state of the instance.
+   *
+   * This function destroys the internal instance, releasing its buffers.
+   */
+  void reset() { _instance.reset(); }
+
+  /**
+   * @brief Sets the seed of the priorities, 0 by default.
+   */
+  void setSeed(uint64_t seed) { _seed = seed; }
+
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
+  /**
+   * @brief Runs the computation.
+   *
+   * The function performs the following steps while some vertices are undecided:
+   * 1. An advance over the undecided vertices marks those with a neighbor that joined the set at the previous round as
+   *    excluded, and those with an undecided neighbor of higher priority as beaten. Equal priorities are broken by id.
+   * 2. `filter::external` keeps the beaten vertices for the next round, dropping the decided ones: the excluded ones,
+   *    and those not beaten, which join the set.
+   *
+   * A vertex excluded while the advance reads it is either still seen as a competitor, which only delays its neighbor
+   * by a round, or already ignored, which is right since it cannot join the set.
+   *
+   * @throws std::runtime_error if the instance is not initialized.
+   */
+  template<bool EnableProfiling = false>
+  void run() {
+    if (!_instance) { throw std::runtime_error("MIS instance not initialized"); }
+
+    using instance_t = detail::MISInstance<GraphType>;
+    auto& G = _instance->G;
+    auto members = _instance->members;
+    auto status = _instance->status;
+    const uint64_t seed = _seed;
+    auto lb = _load_balancer.value_or(sygraph::tuning::getProfile().load_balancer);
+    _instance->frontiers.visit([&](auto& frontiers) {
+      using load_balance_t = sygraph::operators::load_balancer;
+      using frontier_view_t = sygraph::frontier::frontier_view;
+      auto& in = frontiers.in;
+      auto& out = frontiers.out;
+
+      _instance->ready.wait_and_throw();
+      _instance->dirty = true;
+
+      while (!in.empty()) {
+        const uint64_t round = _instance->rounds;
+        auto compete = [=](auto src, auto dst, auto edge, auto weight) -> bool {
+          if (dst == src) { return false; }
+          if (members[dst] != 0) {
+            sygraph::sync::atomicCombine(status + src, instance_t::excluded, sycl::maximum<uint32_t>());
+          } else if (status[dst] != instance_t::excluded) {
+            const uint64_t src_priority = sygraph::random::bits(seed, round, src);
+            const uint64_t dst_priority = sygraph::random::bits(seed, round, dst);
+            if (dst_priority > src_priority || (dst_priority == src_priority && dst > src)) {
+              sygraph::sync::atomicCombine(status + src, instance_t::beaten, sycl::maximum<uint32_t>());
+            }
+          }
+          return false;
+        };
+        auto e1 = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+          return sygraph::operators::advance::frontier<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(G, in, out, compete);
+        });
+        e1.waitAndThrow();
+
+        auto e2 = sygraph::operators::filter::external(G, in, out, [=](auto vertex) {
+          if (status[vertex] == instance_t::excluded) { return false; }
+          if (status[vertex] == instance_t::beaten) {
+            status[vertex] = 0;
+            return true;
+          }
+          members[vertex] = 1;
+          return false;
+        });
+        e2.waitAndThrow();
+#ifdef ENABLE_PROFILING
+        sygraph::Profiler::addEvent(e1, "advance");
+        sygraph::Profiler::addEvent(e2, "filter");
+#endif
+        sygraph::frontier::swap(in, out);
+        _instance->rounds++;
+      }
+    });
+    _instance->dirty = false;
+  }
+
+  /**
+   * @brief Returns whether a vertex is in the set.
+   */
+  bool contains(size_t vertex) const {
+    if (!_instance) { throw std::runtime_error("MIS instance not initialized"); }
+    uint32_t value = 0;
+    _g.getQueue().copy(_instance->members + vertex, &value, 1).wait();
+    return value != 0;
+  }
+
+  /**
+   * @brief Returns, for every vertex, 1 if it is in the set and 0 otherwise, in device memory.
+   */
+  const uint32_t* getMembers() const {
+    if (!_instance) { throw std::runtime_error("MIS instance not initialized"); }
+    return _instance->members;
+  }
+
+  /**
+   * @brief Returns the number of vertices in the set.
+   */
+  size_t getSize() const {
+    if (!_instance) { throw std::runtime_error("MIS instance not initialized"); }
+    sycl::queue& queue = _g.getQueue();
+    auto members = _instance->members;
+    auto size = _instance->size;
+    queue.fill(size, 0U, 1).wait();
+    queue.submit([&](sycl::handler& cgh) {
+       cgh.parallel_for(sycl::range<1>(_g.getVertexCount()), sycl::reduction(size, 0U, sycl::plus<uint32_t>()), [=](sycl::id<1> idx, auto& acc) {
+         acc += members[idx[0]];
+       });
+     }).wait_and_throw();
+    uint32_t value = 0;
+    queue.copy(size, &value, 1).wait();
+    return value;
+  }
+
+  /**
+   * @brief Returns the number of rounds run.
+   */
+  size_t getRoundCount() const {
+    if (!_instance) { throw std::runtime_error("MIS instance not initialized"); }
+    return _instance->rounds;
+  }
+
+private:
+  GraphType& _g;
+  std::unique_ptr<detail::MISInstance<GraphType>> _instance;
+  uint64_t _seed = 0;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
+};
+
+} // namespace algorithms
+} // namespace sygraph
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/utils/memory.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+#include <sygraph/utils/random.hpp>
+
+
+namespace sygraph {
+namespace algorithms {
+
+/**
+ * @brief How a walk chooses the next vertex among the out-neighbors of the current one.
+ */
+enum class walk_bias {
+  uniform,  ///< Every neighbor is equally likely.
+  weighted, ///< A neighbor is chosen with probability proportional to the weight of its edge.
+  node2vec  ///< Second-order transitions biased by the return parameter `p` and the in-out parameter `q`.
+};
+
+namespace detail {
+
+// Whether `x` is an out-neighbor of `t`, by binary search in the sorted adjacency of `t`.
+template<typename GraphDevT>
+SYCL_EXTERNAL inline bool isNeighbor(const GraphDevT& graph_dev, typename GraphDevT::vertex_t t, typename GraphDevT::vertex_t x) {
+  auto begin = graph_dev.begin(t);
+  size_t low = 0;
+  size_t high = graph_dev.getDegree(t);
+  while (low < high) {
+    const size_t mid = low + ((high - low) / 2);
+    if (*(begin + mid) < x) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low < graph_dev.getDegree(t) && *(begin + low) == x;
+}
+
+template<typename GraphType>
+struct RandomWalkInstance {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using weight_t = typename GraphType::weight_t;
+
+  GraphType& G;
+  const vertex_t* starts = nullptr;
+  size_t num_walks = 0;
+  size_t length = 0;
+  vertex_t* walks = nullptr;
+  uint64_t seed = 0;
+
+  // the alias table of every vertex over its out-edges, built on the first weighted run and kept for the next ones
+  float* alias_probabilities = nullptr;
+  edge_t* alias_edges = nullptr;
+
+  RandomWalkInstance(GraphType& G) : G(G) {}
+
+  /**
+   * @brief Builds the alias tables of all vertices with Vose's method, a work-item per vertex.
+   *
+   * Every edge keeps the probability of being taken when its slot is drawn, and the edge taken otherwise, so a weighted
+   * step costs one draw of a slot and one coin flip whatever the degree. The slots below and above the average weight
+   * are kept as two stacks growing from the ends of the row in a scratch array.
+   */
+  void buildAliasTables() {
+    if (alias_probabilities != nullptr) { return; }
+    sycl::queue& queue = G.getQueue();
+    const size_t num_edges = G.getEdgeCount();
+    alias_probabilities = memory::detail::memoryAlloc<float, memory::space::device>(num_edges, queue);
+    alias_edges = memory::detail::memoryAlloc<edge_t, memory::space::device>(num_edges, queue);
+    edge_t* stacks = memory::detail::memoryAlloc<edge_t, memory::space::device>(num_edges, queue);
+
+    auto graph_dev = G.getDeviceGraph();
+    auto probabilities = alias_probabilities;
+    auto aliases = alias_edges;
+    auto e = queue.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::range<1>{G.getVertexCount()}, [=](sycl::id<1> idx) {
+        const auto vertex = static_cast<vertex_t>(idx[0]);
+        const edge_t first = graph_dev.getFirstNeighbor(vertex);
+        const edge_t last = first + static_cast<edge_t>(graph_dev.getDegree(vertex));
+        float total = 0.0f;
+        for (edge_t edge = first; edge < last; edge++) { total += static_cast<float>(graph_dev.getEdgeWeight(edge)); }
+
+        edge_t small_top = first;
+        edge_t large_bottom = last;
+        for (edge_t edge = first; edge < last; edge++) {
+          const float scaled = total > 0.0f ? static_cast<float>(graph_dev.getEdgeWeight(edge)) * static_cast<float>(last - first) / total : 1.0f;
+          probabilities[edge] = scaled;
+          aliases[edge] = edge;
+          if (scaled < 1.0f) {
+            stacks[small_top++] = edge;
+          } else {
+            stacks[--large_bottom] = edge;
+          }
+        }
+        // every light slot is topped up by a heavy edge, which becomes light once it gave away its excess
+        while (small_top > first && large_bottom < last) {
+          const edge_t light = stacks[--small_top];
+          const edge_t heavy = stacks[large_bottom++];
+          aliases[light] = heavy;
+          probabilities[heavy] += probabilities[light] - 1.0f;
+          if (probabilities[heavy] < 1.0f) {
+            stacks[small_top++] = heavy;
+          } else {
+            stacks[--large_bottom] = heavy;
+          }
+        }
+        // the slots left in either stack are full up to rounding
+        while (large_bottom < last) { probabilities[stacks[large_bottom++]] = 1.0f; }
+        while (small_top > first) { probabilities[stacks[--small_top]] = 1.0f; }
+      });
+    });
+    e.wait_and_throw();
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addEvent(e, "alias_tables");
+#endif
+    memory::detail::releaseUSM(stacks, queue);
+  }
+
+  ~RandomWalkInstance() {
+    sycl::queue& queue = G.getQueue();
+    if (alias_probabilities != nullptr) {
+      memory::detail::releaseUSM(alias_probabilities, queue);
+      memory::detail::releaseUSM(alias_edges, queue);
+    }
+  }
+};
+} // namespace detail
+
+
+/**
+ * @class RandomWalk
+ * @brief Generates fixed-length random walks over the out-edges of a graph, for graph embeddings.
+ *
+ * Every walk is generated by its own work-item from its own random stream, so the walks of a seed are the same
+ * whatever the schedule. Uniform and weighted steps take constant time; node2vec steps also check whether the
+ * candidate neighbors the previous vertex, by binary search in its sorted adjacency.
+ *
+ * @tparam GraphType The type of the graph on which the walks are generated.
+ */
+template<typename GraphType>
+class RandomWalk {
+  using vertex_t = typename GraphType::vertex_t;
+  using edge_t = typename GraphType::edge_t;
+  using weight_t = typename GraphType::weight_t;
+
+public:
+  /**
+   * @brief The vertex that fills the rest of a walk that reached a vertex without out-edges.
+   */
+  static constexpr vertex_t invalid_vertex = static_cast<vertex_t>(-1);
+
+  RandomWalk(GraphType& g) : _g(g) {};
+
+  /**
+   * @brief Prepares a batch of walks. The instance and its alias tables are kept from the previous batches.
+   *
+   * @param starts The first vertex of every walk, in device memory.
+   * @param num_walks The number of walks.
+   * @param length The number of vertices of every walk, the first one included.
+   * @param walks The `num_walks * length` output vertices in device memory, walk after walk.
+   * @param seed The seed of the random draws.
+   */
+  void init(const vertex_t* starts, size_t num_walks, size_t length, vertex_t* walks, uint64_t seed = 0) {
+    if (!_instance) { _instance = std::make_unique<detail::RandomWalkInstance<GraphType>>(_g); }
+    _instance->starts = starts;
+    _instance->num_walks = num_walks;
+    _instance->length = length;
+    _instance->walks = walks;
+    _instance->seed = seed;
+  }
+
+  /**
+   * @brief Resets the internal state of the instance.
+   *
+   * This function destroys the internal instance, releasing its alias tables.
+   */
+  void reset() { _instance.reset(); }
+
+  /**
+   * @brief Sets how the next vertex of a walk is chosen, `walk_bias::uniform` by default.
+   */
+  void setBias(walk_bias bias) { _bias = bias; }
+
+  /**
+   * @brief Sets the node2vec parameters: a walk returns to its previous vertex with weight `1 / p`, moves to a neighbor
+   * of it with weight 1 and moves away from it with weight `1 / q`. Both default to 1.
+   *
+   * @throws std::runtime_error if a parameter is not positive.
+   */
+  void setNode2VecParameters(float p, float q) {
+    if (!(p > 0.0f) || !(q > 0.0f)) { throw std::runtime_error("RandomWalk: node2vec parameters must be positive"); }
+    _p = p;
+    _q = q;
+  }
+
+  /**
+   * @brief Generates the walks of the batch.
+   *
+   * node2vec steps draw a candidate from the first-order distribution (weighted when the graph is weighted) and accept
+   * it with its bias divided by the largest bias, the rejection sampling of KnightKing. After a few rejections, which
+   * only happen when the biases are very uneven, the step is drawn exactly from the biased weights of all neighbors.
+   *
+   * @throws std::runtime_error if the instance is not initialized.
+   */
+  template<bool EnableProfiling = false>
+  void run() {
+    if (!_instance) { throw std::runtime_error("RandomWalk instance not initialized"); }
+
+    auto& G = _instance->G;
+    sycl::queue& queue = G.getQueue();
+    const bool use_alias = _bias == walk_bias::weighted || (_bias == walk_bias::node2vec && G.getProperties().weighted);
+    if (use_alias) { _instance->buildAliasTables(); }
+
+    auto graph_dev = G.getDeviceGraph();
+    auto starts = _instance->starts;
+    auto walks = _instance->walks;
+    auto probabilities = _instance->alias_probabilities;
+    auto aliases = _instance->alias_edges;
+    const size_t length = _instance->length;
+    const uint64_t seed = _instance->seed;
+    const bool node2vec = _bias == walk_bias::node2vec;
+    const bool weighted = G.getProperties().weighted;
+    const float return_bias = 1.0f / _p;
+    const float out_bias = 1.0f / _q;
+    const float max_bias = std::max({return_bias, 1.0f, out_bias});
+
+    auto e = queue.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::range<1>{_instance->num_walks}, [=](sycl::id<1> idx) {
+        constexpr int max_rejections = 16;
+        sygraph::random::Generator rng{seed, 0, idx[0]};
+        vertex_t* walk = walks + (idx[0] * length);
+        vertex_t current = starts[idx[0]];
+        vertex_t previous = invalid_vertex;
+        if (length > 0) { walk[0] = current; }
+
+        auto bias = [=](vertex_t candidate, vertex_t from) {
+          if (candidate == from) { return return_bias; }
+          return detail::isNeighbor(graph_dev, from, candidate) ? 1.0f : out_bias;
+        };
+
+        for (size_t step = 1; step < length; step++) {
+          const size_t degree = graph_dev.getDegree(current);
+          if (degree == 0) {
+            for (; step < length; step++) { walk[step] = invalid_vertex; }
+            return;
+          }
+          const edge_t first = graph_dev.getFirstNeighbor(current);
+          edge_t edge = first;
+          int attempts = 0;
+          while (true) {
+            const edge_t slot = first + static_cast<edge_t>(rng.nextBelow(degree));
+            edge = use_alias && rng.nextUniform() > probabilities[slot] ? aliases[slot] : slot;
+            if (!node2vec || previous == invalid_vertex) { break; }
+            if (rng.nextUniform() * max_bias <= bias(graph_dev.getDestinationVertex(edge), previous)) { break; }
+            if (++attempts < max_rejections) { continue; }
+
+            // the exact draw over the biased weights of all the neighbors
+            float total = 0.0f;
+            for (edge_t candidate = first; candidate < first + degree; candidate++) {
+              const float w = weighted ? static_cast<float>(graph_dev.getEdgeWeight(candidate)) : 1.0f;
+              total += w * bias(graph_dev.getDestinationVertex(candidate), previous);
+            }
+            float target = rng.nextUniform() * total;
+            for (edge = first; edge + 1 < first + degree; edge++) {
+              const float w = weighted ? static_cast<float>(graph_dev.getEdgeWeight(edge)) : 1.0f;
+              target -= w * bias(graph_dev.getDestinationVertex(edge), previous);
+              if (target <= 0.0f) { break; }
+            }
+            break;
+          }
+          previous = current;
+          current = graph_dev.getDestinationVertex(edge);
+          walk[step] = current;
+        }
+      });
+    });
+    e.wait_and_throw();
+
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addEvent(e, "random_walk");
+#endif
+  }
+
+private:
+  GraphType& _g;
+  std::unique_ptr<detail::RandomWalkInstance<GraphType>> _instance;
+  walk_bias _bias = walk_bias::uniform;
+  float _p = 1.0f;
+  float _q = 1.0f;
+};
+
+} // namespace algorithms
+} // namespace sygraph
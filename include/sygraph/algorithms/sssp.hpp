@@ -7,6 +7,7 @@
 #include <sycl/sycl.hpp>
 
 #include <memory>
+#include <optional>
 #include <vector>
 #include <sygraph/frontier/frontier.hpp>
 #include <sygraph/graph/graph.hpp>
@@ -17,6 +18,7 @@
 #include <sygraph/utils/profiler.hpp>
 #endif
 #include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/tuning.hpp>
 
 
 namespace sygraph {
@@ -28,6 +30,7 @@ struct SSSPInstance {
   using vertex_t = typename GraphType::vertex_t;
   using edge_t = typename GraphType::edge_t;
   using weight_t = typename GraphType::weight_t;
+  using frontiers_t = sygraph::frontier::FrontierPair<vertex_t, sygraph::frontier::frontier_type::mlb>;
 
   GraphType& G;
   vertex_t source;
@@ -35,19 +38,50 @@ struct SSSPInstance {
   vertex_t* parents;
   int* visited;
 
-  SSSPInstance(GraphType& G, vertex_t source) : G(G), source(source) {
+  frontiers_t frontiers; // input and output frontiers, with the device's bitmap word
+  bool dirty = false; // set while a run is in progress, the frontiers must be cleared if it did not complete
+  sycl::event ready;
+
+  // relaxations may still lower the distance of a frontier vertex, so pulls run on the whole graph
+  sygraph::operators::advance::DirectionOptimizer<sygraph::operators::direction::pull_all, sygraph::frontier::frontier_view::graph, true> optimizer;
+
+  SSSPInstance(GraphType& G) : G(G), source(0), frontiers(G.getQueue(), G.getVertexCount()), optimizer(G) {
     sycl::queue& queue = G.getQueue();
     size_t size = G.getVertexCount();
 
     distances = memory::detail::memoryAlloc<weight_t, memory::space::device>(size, queue);
-    queue.fill(distances, static_cast<weight_t>(size + 1), size).wait();
-    queue.fill(&distances[source], static_cast<weight_t>(0), 1).wait();
-
     parents = memory::detail::memoryAlloc<vertex_t, memory::space::device>(size, queue);
-    queue.fill(parents, static_cast<vertex_t>(-1), size).wait();
-
     visited = memory::detail::memoryAlloc<int, memory::space::device>(size, queue);
-    queue.fill(visited, -1, size).wait();
+  }
+
+  /**
+   * @brief Initializes distances, parents, visited flags and the input frontier for a new source with a single kernel.
+   */
+  void reset(vertex_t source) {
+    sycl::queue& queue = G.getQueue();
+    size_t size = G.getVertexCount();
+
+    this->source = source;
+    auto distances = this->distances;
+    auto parents = this->parents;
+    auto visited = this->visited;
+    frontiers.visit([&](auto& pair) {
+      if (dirty) {
+        pair.in.clear();
+        pair.out.clear();
+        dirty = false;
+      }
+
+      auto in_dev_frontier = pair.in.getDeviceFrontier();
+      ready = queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> idx) {
+          distances[idx] = idx[0] == source ? static_cast<weight_t>(0) : static_cast<weight_t>(size + 1);
+          parents[idx] = static_cast<vertex_t>(-1);
+          visited[idx] = -1;
+          if (idx[0] == source) { in_dev_frontier.insert(source); }
+        });
+      });
+    });
   }
 
   size_t getVisitedVertices() const {
@@ -111,26 +145,42 @@ public:
   /**
    * @brief Initializes the Single Source Shortest Path (SSSP) algorithm instance.
    *
-   * This function initializes the SSSP algorithm by creating a new instance of
-   * the SSSPInstance class with the provided graph and source vertex. It also
-   * sets the distance to the source vertex to zero.
+   * The SSSPInstance holding distances, parents and frontiers is created on the first call
+   * only; later calls reset it in place for the new source without allocating memory.
    *
    * @param source The source vertex from which to start the SSSP algorithm.
    */
   void init(vertex_t& source) {
-    _instance = std::make_unique<detail::SSSPInstance<GraphType>>(_g, source);
-    _instance->distances[source] = 0;
+    if (!_instance) { _instance = std::make_unique<detail::SSSPInstance<GraphType>>(_g); }
+    _instance->reset(source);
   }
 
 
   /**
    * @brief Resets the internal state of the instance.
    *
-   * This function calls the reset method on the internal instance,
-   * effectively resetting its state to the initial configuration.
+   * This function destroys the internal instance, releasing its buffers.
    */
   void reset() { _instance.reset(); }
 
+  /**
+   * @brief Sets the load balancer of the advances, overriding the one of the tuning profile.
+   */
+  void setLoadBalancer(sygraph::operators::load_balancer lb) { _load_balancer = lb; }
+
+  /**
+   * @brief Sets the direction of the advances: `direction::push`, the default, or `direction::automatic`, which pulls
+   * the distances into every vertex while the frontier is large.
+   *
+   * @throws std::runtime_error for the other directions.
+   */
+  void setDirection(sygraph::operators::direction direction) {
+    if (direction != sygraph::operators::direction::push && direction != sygraph::operators::direction::automatic) {
+      throw std::runtime_error("SSSP supports the push and automatic directions only");
+    }
+    _direction = direction;
+  }
+
   /**
    * @brief Executes the Single Source Shortest Path (SSSP) algorithm.
    *
@@ -141,11 +191,11 @@ public:
    * @throws std::runtime_error if the SSSP instance is not initialized.
    *
    * The function performs the following steps:
-   * 1. Initializes the in_frontier with the source vertex.
+   * 1. Starts from the in_frontier holding the source vertex, as prepared by init.
    * 2. Iteratively processes the graph until the in_frontier is empty:
-   *    a. Advances the frontier by exploring neighboring vertices and updating distances.
-   *    b. Filters the out_frontier to remove already visited vertices.
-   *    c. Clears the out_frontier and increments the iteration counter.
+   *    a. Advances the frontier by relaxing the distances of the neighboring vertices, keeping each relaxed vertex once
+   *       in the out_frontier, in a single fused kernel.
+   *    b. Swaps the frontiers, clears the out_frontier and increments the iteration counter.
    *
    * Profiling events are recorded if ENABLE_PROFILING is defined.
    */
@@ -154,56 +204,61 @@ public:
     if (!_instance) { throw std::runtime_error("SSSP instance not initialized"); }
 
     auto& G = _instance->G;
-    auto& source = _instance->source;
     auto& distances = _instance->distances;
-    auto& parents = _instance->parents;
     auto& visited = _instance->visited;
-
-    sycl::queue& queue = G.getQueue();
-
-    using load_balance_t = sygraph::operators::load_balancer;
-    using direction_t = sygraph::operators::direction;
-    using frontier_view_t = sygraph::frontier::frontier_view;
-    using frontier_impl_t = sygraph::frontier::frontier_type;
-
-    auto in_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(queue, G);
-    auto out_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(queue, G);
-
-    size_t size = G.getVertexCount();
-
-    int iter = 0;
-    in_frontier.insert(source);
-
-    while (!in_frontier.empty()) {
-      auto e1 = sygraph::operators::advance::
-          frontier<load_balance_t::workgroup_mapped, sygraph::frontier::frontier_view::vertex, sygraph::frontier::frontier_view::vertex>(
-              G, in_frontier, out_frontier, [=](auto src, auto dst, auto edge, auto weight) -> bool {
-                weight_t source_distance = sygraph::sync::load(&distances[src]);
-                weight_t distance_to_neighbor = source_distance + weight;
-
-                // Check if the destination node has been claimed as someone's child
-                weight_t recover_distance = sygraph::sync::load(&distances[dst]);
-                recover_distance = sygraph::sync::min(&(distances[dst]), &distance_to_neighbor);
-
-                return (distance_to_neighbor < recover_distance);
-              });
-      e1.wait();
-
-      auto e2 = sygraph::operators::filter::external(G, out_frontier, in_frontier, [=](auto vertex) -> bool {
-        if (visited[vertex] == iter) return false;
-        visited[vertex] = iter;
-        return true;
-      });
-      e2.wait();
+    auto lb = _load_balancer.value_or(sygraph::tuning::getProfile().load_balancer);
+    _instance->frontiers.visit([&](auto& frontiers) {
+      auto& in_frontier = frontiers.in;
+      auto& out_frontier = frontiers.out;
+
+      using load_balance_t = sygraph::operators::load_balancer;
+
+      _instance->ready.wait_and_throw();
+      _instance->dirty = true;
+
+      using direction_t = sygraph::operators::direction;
+      using frontier_view_t = sygraph::frontier::frontier_view;
+
+      int iter = 0;
+      auto relax = [=](auto src, auto dst, auto edge, auto weight) -> bool {
+        weight_t source_distance = sygraph::sync::load(&distances[src]);
+        weight_t distance_to_neighbor = source_distance + weight;
+
+        // Check if the destination node has been claimed as someone's child
+        weight_t recover_distance = sygraph::sync::load(&distances[dst]);
+        recover_distance = sygraph::sync::min(&(distances[dst]), &distance_to_neighbor);
+
+        return (distance_to_neighbor < recover_distance);
+      };
+      if (_direction == direction_t::automatic) { _instance->optimizer.reset(); }
+
+      while (!in_frontier.empty()) {
+        // a vertex relaxed by several edges enters the next frontier once
+        auto dedupe = [=](auto vertex) -> bool {
+          if (visited[vertex] == iter) return false;
+          visited[vertex] = iter;
+          return true;
+        };
+        auto e = sygraph::operators::advance::dispatchLoadBalancer(lb, [&]<load_balance_t Lb>() {
+          if (_direction == direction_t::automatic) {
+            return sygraph::operators::advance::frontier_filtered<direction_t::automatic, Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+                G, in_frontier, out_frontier, relax, dedupe, _instance->optimizer);
+          }
+          return sygraph::operators::advance::frontier_filtered<Lb, frontier_view_t::vertex, frontier_view_t::vertex>(
+              G, in_frontier, out_frontier, relax, dedupe);
+        });
+        e.wait();
 
 #ifdef ENABLE_PROFILING
-      sygraph::Profiler::addEvent(e1, "advance");
-      sygraph::Profiler::addEvent(e2, "filter");
+        sygraph::Profiler::addEvent(e, "advance_filter");
 #endif
 
-      out_frontier.clear();
-      iter++;
-    }
+        sygraph::frontier::swap(out_frontier, in_frontier);
+        out_frontier.clear();
+        iter++;
+      }
+    });
+    _instance->dirty = false;
 #ifdef ENABLE_PROFILING
     sygraph::Profiler::addVisitedEdges(_instance->getVisitedEdges());
 #endif
@@ -219,6 +274,8 @@ public:
 private:
   GraphType& _g;
   std::unique_ptr<detail::SSSPInstance<GraphType>> _instance;
+  std::optional<sygraph::operators::load_balancer> _load_balancer;
+  sygraph::operators::direction _direction = sygraph::operators::direction::push;
 };
 
 } // namespace algorithms
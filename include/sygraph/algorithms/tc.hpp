@@ -4,8 +4,8 @@
  */
 #pragma once
 
-#include "sygraph/operators/advance/advance.hpp"
 #include "sygraph/operators/config.hpp"
+#include "sygraph/operators/intersection/intersection.hpp"
 #include "sygraph/utils/memory.hpp"
 #include <sycl/sycl.hpp>
 
@@ -58,7 +58,14 @@ public:
   TC(GraphType& g) : _g(g) {};
 
 
-  void init() { _instance = std::make_unique<detail::TCInstance<GraphType>>(_g); }
+  void init() {
+    if (!_instance) {
+      _instance = std::make_unique<detail::TCInstance<GraphType>>(_g);
+      return;
+    }
+    // reuse the counters of the previous run
+    _g.getQueue().fill(_instance->triangles, static_cast<uint32_t>(0), _g.getVertexCount()).wait();
+  }
 
 
   void reset() { _instance.reset(); }
@@ -73,38 +80,11 @@ public:
 
     sycl::queue& queue = G.getQueue();
 
-    size_t num_nodes = G.getVertexCount();
-    auto graph_dev = G.getDeviceGraph();
-
-    constexpr auto lb = sygraph::operators::load_balancer::workgroup_mapped;
-    auto e = sygraph::operators::advance::vertices<lb>(G, [=](auto u, auto v, auto e, auto w) {
-      (void)e;
-      (void)w;
-
-      if (u >= v) { return false; }
-
-      auto src_it = graph_dev.begin(u);
-      auto src_end = graph_dev.end(u);
-      auto dst_it = graph_dev.begin(v);
-      auto dst_end = graph_dev.end(v);
-
-      int local_triangles = 0;
-
-      while (src_it != src_end && dst_it != dst_end) {
-        if (*src_it == *dst_it) {
-          ++local_triangles;
-          ++src_it;
-          ++dst_it;
-        } else if (*src_it < *dst_it) {
-          ++src_it;
-        } else {
-          ++dst_it;
-        }
-
-        if (local_triangles > 0) { sygraph::sync::atomicFetchAdd<uint32_t>(triangles + u, local_triangles); }
-      }
-      return false;
-    });
+    // every triangle is found once from each of its three edges (u, v) with u < v
+    auto e = sygraph::operators::intersection::edges(
+        G,
+        [=](auto u, auto, auto, auto) { sygraph::sync::atomicFetchAdd<uint32_t>(triangles + u, 1U); },
+        [](auto u, auto v) { return u < v; });
 
     e.wait();
 #ifdef ENABLE_PROFILING
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/utils/memory.hpp>
+
+namespace sygraph {
+namespace frontier {
+
+/**
+ * @brief Tells an iterative algorithm when its input frontier became empty, with as few host round trips as possible.
+ *
+ * With a period of 1, or on out-of-order queues, every call waits for `empty()`. Otherwise a call only enqueues the
+ * check into a slot of host-pinned memory, and the host reads the slots once every `period` calls: the iterations
+ * started meanwhile on an empty frontier find nothing to do. Together with advances launched with
+ * `frontier::size::infer_from_device`, an iteration then runs without any host synchronization.
+ */
+class ConvergenceCheck {
+public:
+  /**
+   * @brief Creates a check reading the flags of `period` iterations at a time.
+   */
+  ConvergenceCheck(sycl::queue& q, size_t period = 1) : _queue(q) { reset(period); }
+
+  ConvergenceCheck(const ConvergenceCheck&) = delete;
+  ConvergenceCheck& operator=(const ConvergenceCheck&) = delete;
+
+  ~ConvergenceCheck() {
+    if (_flags) { memory::detail::releaseUSM(_flags, _queue); }
+  }
+
+  /**
+   * @brief Returns true if iterations are launched without waiting for the previous ones.
+   */
+  bool asynchronous() const { return _period > 1; }
+
+  /**
+   * @brief Returns the number of checks whose flags are read at once.
+   */
+  size_t period() const { return _period; }
+
+  /**
+   * @brief Starts a new run.
+   */
+  void reset() {
+    _calls = 0;
+    _iterations = 0;
+    _converged = false;
+  }
+
+  /**
+   * @brief Starts a new run with another period. The flags are reallocated only if they grow, so a check owned by an
+   * algorithm instance does not allocate on every run.
+   */
+  void reset(size_t period) {
+    _period = _queue.is_in_order() ? std::max<size_t>(1, period) : 1;
+    if (_period > _capacity && _period > 1) {
+      if (_flags) { memory::detail::releaseUSM(_flags, _queue); }
+      _flags = memory::detail::memoryAlloc<uint32_t, memory::space::host>(_period, _queue);
+      _capacity = _period;
+    }
+    reset();
+  }
+
+  /**
+   * @brief Returns the host-pinned flag of the `i`-th check of a period, for iteration bodies recorded with their checks.
+   *
+   * Such a body writes `frontier.empty(slot(i))` itself, and `collect` reads the flags once the period has run.
+   */
+  uint32_t* slot(size_t i) const { return _flags + i; }
+
+  /**
+   * @brief Waits for the queue and reads the flags of a period, returns true if one of them found an empty frontier.
+   */
+  bool collect() {
+    _queue.wait_and_throw();
+    for (size_t i = 0; i < _period && !_converged; i++) {
+      if (_flags[i]) {
+        _converged = true;
+      } else {
+        _iterations++;
+      }
+    }
+    return _converged;
+  }
+
+  /**
+   * @brief Returns true once the frontier has been found empty. Call it at the start of every iteration.
+   *
+   * In asynchronous mode, a false result only means that the frontier was not known to be empty yet.
+   */
+  template<typename FrontierT>
+  bool converged(const FrontierT& frontier) {
+    if (_converged) { return true; }
+    if constexpr (requires { frontier.empty(_flags); }) {
+      if (asynchronous()) {
+        frontier.empty(_flags + _calls % _period);
+        if (++_calls % _period != 0) { return false; }
+        return collect();
+      }
+    }
+    _converged = frontier.empty();
+    if (!_converged) { _iterations++; }
+    return _converged;
+  }
+
+  /**
+   * @brief Returns the iterations that started on a non-empty frontier, the ones that did the work of the run.
+   */
+  size_t getIterations() const { return _iterations; }
+
+private:
+  sycl::queue& _queue;
+  size_t _period = 1;
+  size_t _capacity = 0;
+  uint32_t* _flags = nullptr;
+  size_t _calls = 0;
+  size_t _iterations = 0;
+  bool _converged = false;
+};
+
+} // namespace frontier
+} // namespace sygraph
@@ -7,28 +7,35 @@
 #include <sygraph/frontier/frontier_settings.hpp>
 #include <sygraph/frontier/impls/bitmap_frontier.hpp>
 #include <sygraph/frontier/impls/mlb_frontier.hpp>
+#include <sygraph/utils/device.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace sygraph {
 namespace frontier {
 namespace detail {
-template<typename T, frontier_type Type>
+template<typename T, frontier_type Type, typename B = types::bitmap_type_t>
 class frontier_impl_t;
 
-template<typename T>
-class frontier_impl_t<T, frontier_type::none> {
+template<typename T, typename B>
+class frontier_impl_t<T, frontier_type::none, B> {
 public:
   frontier_impl_t() {};
   const bool getDeviceFrontier() const { return false; }
 };
 
-template<typename T>
-class frontier_impl_t<T, frontier_type::bitmap> : public FrontierBitmap<T> {
+template<typename T, typename B>
+class frontier_impl_t<T, frontier_type::bitmap, B> : public FrontierBitmap<T> {
+  static_assert(std::is_same_v<B, types::bitmap_type_t>, "The bitmap frontier only supports the default bitmap word");
   using FrontierBitmap<T>::FrontierBitmap;
 };
 
-template<typename T>
-class frontier_impl_t<T, frontier_type::mlb> : public FrontierMLB<T> {
-  using FrontierMLB<T>::FrontierMLB;
+template<typename T, typename B>
+class frontier_impl_t<T, frontier_type::mlb, B> : public FrontierMLB<T, 2, MLBDevice<T, 2, B>> {
+  using FrontierMLB<T, 2, MLBDevice<T, 2, B>>::FrontierMLB;
 };
 } // namespace detail
 
@@ -41,12 +48,17 @@ class frontier_impl_t<T, frontier_type::mlb> : public FrontierMLB<T> {
  *
  * @tparam T The type parameter for the frontier implementation.
  * @tparam Type The frontier implementation (bitmap, mlb).
+ * @tparam B The bitmap word, `uint32_t` or `uint64_t`. The deprecated bitmap frontier only accepts the build default,
+ *           `types::bitmap_type_t`.
  */
-template<typename T, frontier_type Type = frontier_type::mlb>
-class Frontier : public detail::frontier_impl_t<T, Type> {
+template<typename T, frontier_type Type = frontier_type::mlb, typename B = types::bitmap_type_t>
+class Frontier : public detail::frontier_impl_t<T, Type, B> {
+  static_assert(std::is_same_v<B, uint32_t> || std::is_same_v<B, uint64_t>, "The bitmap word must be 32 or 64 bits wide");
+
 public:
-  using detail::frontier_impl_t<T, Type>::frontier_impl_t;
+  using detail::frontier_impl_t<T, Type, B>::frontier_impl_t;
   using type_t = T;
+  using word_t = B;
 };
 
 /**
@@ -59,21 +71,22 @@ public:
  *
  * @tparam View The view type, which can be either `frontier_view::vertex` or `frontier_view::edge`.
  * @tparam Type The type of elements stored in the Frontier.
+ * @tparam B The bitmap word of the Frontier.
  * @tparam GraphType The type of the graph.
  * @param q The SYCL queue used for the Frontier.
  * @param graph The graph from which the Frontier is created.
  * @return A Frontier object of the appropriate type and size.
  * @throws std::runtime_error If the view type is invalid.
  */
-template<frontier_view View, frontier_type Type, typename GraphType>
+template<frontier_view View, frontier_type Type, typename B = types::bitmap_type_t, typename GraphType>
 auto makeFrontier(sycl::queue& q, const GraphType& graph) {
   size_t frontier_size = 0;
   if constexpr (View == frontier_view::vertex) {
     frontier_size = graph.getVertexCount();
-    return Frontier<typename GraphType::vertex_t, Type>(q, frontier_size);
+    return Frontier<typename GraphType::vertex_t, Type, B>(q, frontier_size);
   } else if constexpr (View == frontier_view::edge) {
     frontier_size = graph.getEdgeCount();
-    return Frontier<typename GraphType::edge_t, Type>(q, frontier_size);
+    return Frontier<typename GraphType::edge_t, Type, B>(q, frontier_size);
   } else {
     throw std::runtime_error("Invalid frontier view");
   }
@@ -91,14 +104,80 @@ auto makeFrontier(sycl::queue& q, const GraphType& graph) {
  * @param a The first Frontier object to swap.
  * @param b The second Frontier object to swap.
  */
-template<typename T, frontier_type FT>
-void swap(Frontier<T, FT>& a, Frontier<T, FT>& b) {
+template<typename T, frontier_type FT, typename B>
+void swap(Frontier<T, FT, B>& a, Frontier<T, FT, B>& b) {
   if constexpr (FT == frontier_type::bitmap) {
     detail::FrontierBitmap<T>::swap(a, b);
   } else if constexpr (FT == frontier_type::mlb) {
-    detail::FrontierMLB<T>::swap(a, b);
+    detail::FrontierMLB<T, 2, detail::MLBDevice<T, 2, B>>::swap(a, b);
+  }
+}
+
+/**
+ * @brief Invokes `f.template operator()<B>()` with the bitmap word preferred by the queue's device.
+ *
+ * The word width is read from the device profile (`DeviceProfile::bitmap_width`), so it can be changed at runtime
+ * without rebuilding the library.
+ *
+ * @throws std::runtime_error If the profile requests a width other than 32 or 64 bits.
+ */
+template<typename Func>
+decltype(auto) dispatchBitmapWidth(const sycl::queue& q, Func&& f) {
+  switch (sygraph::device::getProfile(q).bitmap_width) {
+    case 32: return f.template operator()<uint32_t>();
+    case 64: return f.template operator()<uint64_t>();
+    default: throw std::runtime_error("Unsupported bitmap width");
   }
 }
 
+namespace detail {
+
+template<typename T, frontier_type Type, typename B>
+struct FrontierPair {
+  using word_t = B;
+  using frontier_t = Frontier<T, Type, B>;
+
+  FrontierPair(sycl::queue& q, size_t num_elems) : in(q, num_elems), out(q, num_elems) {}
+
+  frontier_t in;
+  frontier_t out;
+};
+
+} // namespace detail
+
+/**
+ * @brief Input and output frontiers of an iterative algorithm, with the bitmap word chosen at construction time.
+ *
+ * The word width follows the device profile of the queue. Since the width is a template parameter of the frontier,
+ * the pair is accessed through `visit`, which calls the given generic callable with the typed pair.
+ *
+ * @tparam T The type of elements in the frontiers.
+ * @tparam Type The frontier implementation.
+ */
+template<typename T, frontier_type Type = frontier_type::mlb>
+class FrontierPair {
+public:
+  FrontierPair(sycl::queue& q, size_t num_elems)
+      : _pair(dispatchBitmapWidth(q, [&]<typename B>() -> variant_t {
+          return variant_t{std::in_place_type<detail::FrontierPair<T, Type, B>>, q, num_elems};
+        })) {}
+
+  /**
+   * @brief Returns the bitmap word width of the frontiers, in bits.
+   */
+  size_t getBitmapWidth() const {
+    return std::visit([](const auto& pair) { return sizeof(typename std::decay_t<decltype(pair)>::word_t) * types::detail::byte_size; }, _pair);
+  }
+
+  template<typename Func>
+  decltype(auto) visit(Func&& f) {
+    return std::visit(std::forward<Func>(f), _pair);
+  }
+
+private:
+  using variant_t = std::variant<detail::FrontierPair<T, Type, uint32_t>, detail::FrontierPair<T, Type, uint64_t>>;
+  variant_t _pair;
+};
+
 } // namespace frontier
 } // namespace sygraph
\ No newline at end of file
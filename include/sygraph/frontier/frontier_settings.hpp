@@ -4,6 +4,8 @@
  */
 #pragma once
 
+#include <cstdint>
+
 namespace sygraph {
 namespace frontier {
 
@@ -26,5 +28,14 @@ enum class frontier_type {
   none,   /**< Dummy frontier. Should not use. */
 };
 
+/**
+ * @brief Degree statistics of the vertices spanned by an active frontier, gathered while its offsets are built.
+ */
+struct FrontierStats {
+  uint32_t active_elements = 0; ///< Number of vertices to be processed.
+  uint32_t max_degree = 0;      ///< Largest degree among them.
+  uint64_t degree_sum = 0;      ///< Sum of their degrees.
+};
+
 } // namespace frontier
 } // namespace sygraph
\ No newline at end of file
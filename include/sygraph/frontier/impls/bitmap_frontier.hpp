@@ -5,6 +5,7 @@
 #pragma once
 
 #include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/device.hpp>
 #include <sygraph/utils/memory.hpp>
 #include <sygraph/utils/types.hpp>
 #include <sygraph/utils/vector.hpp>
@@ -255,7 +256,7 @@ public:
         })
         .wait();
     size_t ret = *count;
-    sycl::free(count, _queue);
+    memory::detail::releaseUSM(count, _queue);
     return ret;
   }
 
@@ -394,7 +395,7 @@ public:
   const BitmapDevice<T, bitmap_type>& getDeviceFrontier() const { return _bitmap; }
 
   size_t computeActiveFrontier() const {
-    sycl::range<1> local_range{types::detail::COMPUTE_UNIT_SIZE};
+    sycl::range<1> local_range{sygraph::device::getProfile(_queue).compute_unit_size};
     size_t size = _bitmap.getBitmapSize();
     sycl::range<1> global_range{(size > local_range[0] ? size + local_range[0] - (size % local_range[0]) : local_range[0])};
 
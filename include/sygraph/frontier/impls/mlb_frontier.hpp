@@ -4,12 +4,16 @@
  */
 #pragma once
 
+#include <sygraph/frontier/frontier_settings.hpp>
 #include <sygraph/operators/config.hpp>
 #include <sygraph/sycl/event.hpp>
 #include <sygraph/utils/device.hpp>
 #include <sygraph/utils/memory.hpp>
 #include <sygraph/utils/types.hpp>
 #include <sygraph/utils/vector.hpp>
+
+#include <cstddef>
+#include <type_traits>
 #ifdef ENABLE_PROFILING
 #include <sygraph/utils/profiler.hpp>
 #endif
@@ -19,10 +23,25 @@ namespace frontier {
 
 namespace detail {
 
+// kernel names are parametrized on the device frontier, several bitmap widths can be instantiated in the same program
+template<typename DeviceFrontier, typename GraphDevT, typename GroupDoneT>
 class mlb_compute_active_frontier_kernel;
+
+/**
+ * @brief Work-group hook of the active frontier pass that does nothing.
+ */
+struct NoGroupDone {
+  void operator()(const FrontierStats*, const uint32_t*, size_t) const {}
+};
+template<typename DeviceFrontier>
 class is_mlb_frontier_empty_kernel;
+template<typename DeviceFrontier>
+class is_mlb_frontier_empty_flag_kernel;
+template<typename DeviceFrontier>
 class compute_size_mlb_frontier_kernel;
+template<typename DeviceFrontier>
 class merge_mlb_frontier_kernel;
+template<typename DeviceFrontier>
 class intersect_mlb_frontier_kernel;
 
 
@@ -96,6 +115,17 @@ public:
     return true;
   }
 
+  /**
+   * @brief Inserts `idx` unless it is already in the frontier. Returns true only for the call that inserted it.
+   */
+  SYCL_EXTERNAL inline bool tryInsert(T idx) const {
+    const bitmap_type mask = static_cast<bitmap_type>(1) << (idx % _range);
+    sycl::atomic_ref<bitmap_type, sycl::memory_order::relaxed, sycl::memory_scope::device> ref(_data[0][getBitmapIndex(idx)]);
+    if ((ref.load() & mask) || (ref.fetch_or(mask) & mask)) { return false; }
+    insert(idx); // the upper levels
+    return true;
+  }
+
   SYCL_EXTERNAL inline bool remove(uint32_t idx) const {
     sycl::atomic_ref<bitmap_type, sycl::memory_order::relaxed, sycl::memory_scope::device> ref(_data[0][getBitmapIndex(idx)]);
     ref &= ~(static_cast<bitmap_type>(static_cast<bitmap_type>(1) << (idx % _range)));
@@ -124,6 +154,8 @@ public:
 
   SYCL_EXTERNAL inline uint32_t* getOffsetsSize() const { return _offsets_size; }
 
+  SYCL_EXTERNAL inline FrontierStats* getStats() const { return _stats; }
+
   SYCL_EXTERNAL inline uint32_t getBitmapSize(const uint level) const { return _size[level]; }
 
   SYCL_EXTERNAL inline bitmap_type* getData(const uint level) const { return _data[level]; }
@@ -142,6 +174,8 @@ public:
 
   void setOffsetsSize(uint32_t* offsets_size) { this->_offsets_size = offsets_size; }
 
+  void setStats(FrontierStats* stats) { this->_stats = stats; }
+
 protected:
   uint _range;                ///< The range of the bitmap.
   uint32_t _num_elems;        ///< The number of elements in the bitmap.
@@ -150,6 +184,7 @@ protected:
 
   int* _offsets;
   uint32_t* _offsets_size;
+  FrontierStats* _stats; ///< Degree statistics of the last active frontier computed with a graph.
 };
 
 template<typename T, size_t Levels = 2, DeviceFrontierConcept DeviceFrontier = MLBDevice<T, Levels>>
@@ -172,10 +207,12 @@ public:
     uint32_t* offsets_size = sygraph::memory::detail::memoryAlloc<uint32_t, memory::space::device>(1, _queue);
     auto size = _bitmap.getBitmapSize();
     _queue.fill(offsets_size, static_cast<uint32_t>(0), 1).wait();
+    FrontierStats* stats = sygraph::memory::detail::memoryAlloc<FrontierStats, memory::space::device>(1, _queue);
 
     _bitmap.setData(ptr);
     _bitmap.setOffsets(offsets);
     _bitmap.setOffsetsSize(offsets_size);
+    _bitmap.setStats(stats);
   }
 
   FrontierMLB(const FrontierMLB&) = delete;
@@ -186,6 +223,7 @@ public:
     for (size_t i = 0; i < Levels; i++) { other._bitmap.setData(i, nullptr); }
     other._bitmap.setOffsets(nullptr);
     other._bitmap.setOffsetsSize(nullptr);
+    other._bitmap.setStats(nullptr);
   }
 
   FrontierMLB& operator=(FrontierMLB&&) = delete;
@@ -203,6 +241,10 @@ public:
     auto* offsets_size = _bitmap.getOffsetsSize();
     memory::detail::releaseUSM(offsets_size, _queue);
     _bitmap.setOffsetsSize(offsets_size);
+
+    auto* stats = _bitmap.getStats();
+    memory::detail::releaseUSM(stats, _queue);
+    _bitmap.setStats(stats);
   }
 
   size_t getBitmapSize() const { return _bitmap.getBitmapSize(); }
@@ -216,8 +258,9 @@ public:
   bool empty() const {
     auto bitmap = this->getDeviceFrontier();
 
-    const size_t local_size = types::detail::COMPUTE_UNIT_SIZE;
-    const size_t global_size = local_size * sygraph::detail::device::getNumComputeUnits(_queue);
+    const auto& profile = sygraph::device::getProfile(_queue);
+    const size_t local_size = profile.compute_unit_size;
+    const size_t global_size = local_size * profile.num_compute_units;
 
     size_t bitmap_size = bitmap.getBitmapSize(Levels - 1);
     size_t moduled_size = bitmap_size % local_size ? bitmap_size + local_size - (bitmap_size % local_size) : bitmap_size;
@@ -229,7 +272,7 @@ public:
     auto e = _queue.submit([&](sycl::handler& cgh) {
       sycl::accessor check_acc(check_buf, cgh, sycl::read_write);
 
-      cgh.parallel_for<is_mlb_frontier_empty_kernel>(sycl::nd_range<1>{global_size, local_size}, [=](sycl::nd_item<1> item) {
+      cgh.parallel_for<is_mlb_frontier_empty_kernel<DeviceFrontier>>(sycl::nd_range<1>{global_size, local_size}, [=](sycl::nd_item<1> item) {
         sycl::group<1> group = item.get_group();
         bool tmp = false;
         for (auto i = item.get_global_linear_id(); i < moduled_size && !tmp && !check_acc[0]; i += global_size) {
@@ -245,6 +288,40 @@ public:
     return !check_buf.get_host_access()[0];
   }
 
+  /**
+   * @brief Writes 1 to `flag` if the frontier is empty and 0 otherwise, without waiting for the result.
+   *
+   * `flag` is meant to be host-pinned memory, read by the host only once the returned event completed, so that the
+   * checks of several iterations can be collected with a single synchronization.
+   */
+  sycl::event empty(uint32_t* flag) const {
+    auto bitmap = this->getDeviceFrontier();
+
+    const auto& profile = sygraph::device::getProfile(_queue);
+    const size_t local_size = profile.compute_unit_size;
+    const size_t global_size = local_size * profile.num_compute_units;
+
+    size_t bitmap_size = bitmap.getBitmapSize(Levels - 1);
+    size_t moduled_size = bitmap_size % local_size ? bitmap_size + local_size - (bitmap_size % local_size) : bitmap_size;
+
+    auto fill_e = _queue.fill(flag, static_cast<uint32_t>(1), 1);
+    auto e = _queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(fill_e);
+      cgh.parallel_for<is_mlb_frontier_empty_flag_kernel<DeviceFrontier>>(sycl::nd_range<1>{global_size, local_size}, [=](sycl::nd_item<1> item) {
+        sycl::group<1> group = item.get_group();
+        bool tmp = false;
+        for (auto i = item.get_global_linear_id(); i < moduled_size && !tmp; i += global_size) {
+          tmp = sycl::any_of_group(group, i < bitmap_size ? bitmap.getData(Levels - 1)[i] : 0, [](bitmap_type val) { return val != 0; });
+        }
+        if (group.leader() && tmp) { *flag = 0; }
+      });
+    });
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addEvent(e, "isFrontierEmpty");
+#endif
+    return e;
+  }
+
   bool check(size_t idx) const {
     sycl::buffer<bool, 1> check_buf(sycl::range<1>(1));
     auto e = _queue.submit([&](sycl::handler& cgh) {
@@ -291,7 +368,7 @@ public:
     auto e = _queue.submit([&](sycl::handler& cgh) {
       auto bitmap = this->getDeviceFrontier();
       auto size_acc = size_buf.get_access<sycl::access::mode::write>(cgh);
-      cgh.parallel_for<compute_size_mlb_frontier_kernel>(sycl::range<1>{frontier_size}, [=](sycl::id<1> idx) {
+      cgh.parallel_for<compute_size_mlb_frontier_kernel<DeviceFrontier>>(sycl::range<1>{frontier_size}, [=](sycl::id<1> idx) {
         if (idx[0] == 0) { size_acc[0] = 0; }
         sycl::atomic_ref<size_t, sycl::memory_order::relaxed, sycl::memory_scope::device> ref(size_acc[0]);
         size_t num_active_nodes = 0;
@@ -310,12 +387,12 @@ public:
     return size_acc[0];
   }
 
-  void merge(const FrontierMLB<T>& other) {
+  void merge(const FrontierMLB& other) {
     auto e = _queue.submit([&](sycl::handler& cgh) {
       auto bitmap = this->getDeviceFrontier();
       auto other_bitmap = other.getDeviceFrontier();
-      cgh.parallel_for<merge_mlb_frontier_kernel>(sycl::range<1>(bitmap.getBitmapSize()),
-                                                  [=](sycl::id<1> idx) { bitmap.getData()[idx] |= other_bitmap.getData()[idx]; });
+      cgh.parallel_for<merge_mlb_frontier_kernel<DeviceFrontier>>(sycl::range<1>(bitmap.getBitmapSize()),
+                                                                  [=](sycl::id<1> idx) { bitmap.getData()[idx] |= other_bitmap.getData()[idx]; });
     });
     e.wait();
 #ifdef ENABLE_PROFILING
@@ -323,12 +400,12 @@ public:
 #endif
   }
 
-  void intersect(const FrontierMLB<T>& other) {
+  void intersect(const FrontierMLB& other) {
     auto e = _queue.submit([&](sycl::handler& cgh) {
       auto bitmap = this->getDeviceFrontier();
       auto other_bitmap = other.getDeviceFrontier();
-      cgh.parallel_for<intersect_mlb_frontier_kernel>(sycl::range<1>(bitmap.getBitmapSize()),
-                                                      [=](sycl::id<1> idx) { bitmap.getData()[idx] &= other_bitmap.getData()[idx]; });
+      cgh.parallel_for<intersect_mlb_frontier_kernel<DeviceFrontier>>(sycl::range<1>(bitmap.getBitmapSize()),
+                                                                      [=](sycl::id<1> idx) { bitmap.getData()[idx] &= other_bitmap.getData()[idx]; });
     });
     e.wait();
 #ifdef ENABLE_PROFILING
@@ -376,7 +453,8 @@ public:
 #ifdef ENABLE_PROFILING
     sygraph::Profiler::addEvent(e, "clearFrontierOffsets");
 #endif
-    _queue.wait();
+    // later commands of an in-order queue already run after the fills
+    if (!_queue.is_in_order()) { _queue.wait(); }
   }
 
   const DeviceFrontier& getDeviceFrontier() const { return _bitmap; }
@@ -385,22 +463,67 @@ public:
    * @brief Computes the active frontier by populating the offsets array with the indices of active elements.
    * @param invert If true, computes the inactive frontier instead (for pull-based advance operations).
    */
-  sycl::event computeActiveFrontier(bool invert = false) const {
-    sycl::range<1> local_range{types::detail::COMPUTE_UNIT_SIZE};
+  sycl::event computeActiveFrontier(bool invert = false) const { return computeActiveFrontierImpl(invert, nullptr, NoGroupDone{}); }
+
+  /**
+   * @brief Computes the active frontier and, in the same pass, the degree statistics of the vertices it spans.
+   *
+   * The statistics are written to `getDeviceFrontier().getStats()`. With `invert` they describe the inactive vertices.
+   *
+   * @param invert If true, computes the inactive frontier instead (for pull-based advance operations).
+   * @param graph_dev The device graph providing the degrees.
+   */
+  template<typename GraphDevT>
+  sycl::event computeActiveFrontier(bool invert, const GraphDevT& graph_dev) const {
+    return computeActiveFrontierImpl(invert, graph_dev, NoGroupDone{});
+  }
+
+  /**
+   * @brief Computes the active frontier and its degree statistics, calling `group_done(stats, offsets_size, num_groups)`
+   * from the leader of every work-group once its share of the statistics and of the offsets is published.
+   *
+   * The hook can count the work-groups to let the last one act on the complete statistics, without a further launch.
+   */
+  template<typename GraphDevT, typename GroupDoneT>
+  sycl::event computeActiveFrontier(bool invert, const GraphDevT& graph_dev, GroupDoneT group_done) const {
+    return computeActiveFrontierImpl(invert, graph_dev, group_done);
+  }
+
+  static void swap(FrontierMLB& a, FrontierMLB& b) { std::swap(a._bitmap, b._bitmap); }
+
+protected:
+  sycl::queue& _queue;    ///< The SYCL queue used for memory allocation.
+  DeviceFrontier _bitmap; ///< The bitmap.
+
+  // GraphDevT is std::nullptr_t when no statistics are requested
+  template<typename GraphDevT, typename GroupDoneT>
+  sycl::event computeActiveFrontierImpl(bool invert, const GraphDevT& graph_dev, GroupDoneT group_done) const {
+    constexpr bool collect_stats = !std::is_same_v<GraphDevT, std::nullptr_t>;
+    const auto& profile = sygraph::device::getProfile(_queue);
     auto bitmap = this->getDeviceFrontier();
     size_t size = bitmap.getBitmapSize(1);
+    size_t words = bitmap.getBitmapSize(0);
+    uint32_t num_elems = bitmap.getNumElems();
     uint32_t range = bitmap.getBitmapRange();
+    // every work-item stages up to `range` offsets in local memory, wider words need narrower work-groups
+    size_t group_size = profile.compute_unit_size;
+    while (group_size > profile.sub_group_size && group_size * range * sizeof(int) > profile.local_mem_size) { group_size /= 2; }
+    sycl::range<1> local_range{group_size};
     // sycl::range<1> global_range{(size > local_range[0] ? size + local_range[0] - (size % local_range[0]) : local_range[0])};
-    size_t global_size = sygraph::detail::device::getNumComputeUnits(_queue) * local_range[0];
+    size_t global_size = profile.num_compute_units * local_range[0];
     sycl::range<1> global_range{global_size};
 
+    sycl::event stats_reset;
+    if constexpr (collect_stats) { stats_reset = _queue.memset(bitmap.getStats(), 0, sizeof(FrontierStats)); }
+
     auto e = this->_queue.submit([&](sycl::handler& cgh) {
+      if constexpr (collect_stats) { cgh.depends_on(stats_reset); }
       sycl::local_accessor<int, 1> local_offsets(local_range[0] * range, cgh);
       sycl::local_accessor<uint32_t, 1> local_size(1, cgh);
 
-      cgh.parallel_for<mlb_compute_active_frontier_kernel>(
+      cgh.parallel_for<mlb_compute_active_frontier_kernel<DeviceFrontier, GraphDevT, GroupDoneT>>(
           sycl::nd_range<1>{global_range, local_range},
-          [=, offsets_size = bitmap.getOffsetsSize(), offsets = bitmap.getOffsets()](sycl::nd_item<1> item) {
+          [=, offsets_size = bitmap.getOffsetsSize(), offsets = bitmap.getOffsets(), stats = bitmap.getStats()](sycl::nd_item<1> item) {
             // if (offsets_size[0] > 0) { return; } // TODO optimize for multiple calls on the same frontier
             int gid = item.get_global_linear_id();
             auto group = item.get_group();
@@ -408,6 +531,10 @@ public:
             sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::work_group> local_size_ref(local_size[0]);
             sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::device> offsets_size_ref{offsets_size[0]};
 
+            uint32_t active_elements = 0;
+            uint32_t max_degree = 0;
+            uint64_t degree_sum = 0;
+
             if (group.leader()) { local_size_ref.store(0); }
             sycl::group_barrier(group);
             for (uint32_t gid = item.get_global_linear_id(); gid < size; gid += item.get_global_range(0)) {
@@ -421,6 +548,20 @@ public:
                 }
 
                 local_offsets[local_size_ref++] = static_cast<int>(i + (gid * range));
+
+                if constexpr (collect_stats) {
+                  const size_t word = i + (gid * range);
+                  if (word >= words) { continue; }
+                  bitmap_type bits = invert ? ~bitmap.getData(0)[word] : bitmap.getData(0)[word];
+                  for (uint32_t b = 0; b < range; b++) {
+                    const uint32_t vertex = static_cast<uint32_t>(word * range) + b;
+                    if (vertex >= num_elems || !(bits & (static_cast<bitmap_type>(1) << b))) { continue; }
+                    const uint32_t degree = static_cast<uint32_t>(graph_dev.getDegree(vertex));
+                    active_elements++;
+                    degree_sum += degree;
+                    max_degree = sycl::max(max_degree, degree);
+                  }
+                }
               }
             }
 
@@ -432,6 +573,18 @@ public:
             for (size_t i = item.get_local_linear_id(); i < local_size_ref.load(); i += item.get_local_range(0)) {
               offsets[data_offset + i] = local_offsets[i];
             }
+
+            if constexpr (collect_stats) {
+              active_elements = sycl::reduce_over_group(group, active_elements, sycl::plus<uint32_t>());
+              degree_sum = sycl::reduce_over_group(group, degree_sum, sycl::plus<uint64_t>());
+              max_degree = sycl::reduce_over_group(group, max_degree, sycl::maximum<uint32_t>());
+              if (group.leader()) {
+                sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::device>{stats->active_elements} += active_elements;
+                sycl::atomic_ref<uint64_t, sycl::memory_order::relaxed, sycl::memory_scope::device>{stats->degree_sum} += degree_sum;
+                sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::device>{stats->max_degree}.fetch_max(max_degree);
+                group_done(stats, offsets_size, item.get_group_range(0));
+              }
+            }
           });
     });
 
@@ -440,12 +593,6 @@ public:
 #endif
     return e;
   }
-
-  static void swap(FrontierMLB<T>& a, FrontierMLB<T>& b) { std::swap(a._bitmap, b._bitmap); }
-
-protected:
-  sycl::queue& _queue;    ///< The SYCL queue used for memory allocation.
-  DeviceFrontier _bitmap; ///< The bitmap.
 };
 
 
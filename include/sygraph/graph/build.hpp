@@ -40,6 +40,29 @@ auto fromCSR(sycl::queue& q, sygraph::formats::CSR<ValueT, IndexT, OffsetT>&& cs
   return GraphT{q, std::move(csr), properties};
 };
 
+/**
+ * @brief Constructs a graph from CSR arrays already in device memory, which the graph takes ownership of.
+ *
+ * @tparam Space The memory space the arrays were allocated in.
+ * @param q The SYCL queue to be used for graph operations.
+ * @param n_rows The number of vertices.
+ * @param row_offsets The `n_rows + 1` row offsets.
+ * @param column_indices The column indices, sorted within every row.
+ * @param nnz_values The edge weights.
+ * @param properties Optional properties for the graph.
+ * @return A graph built on the given arrays.
+ */
+template<memory::space Space, typename IndexT, typename OffsetT, typename ValueT>
+auto fromDeviceCSR(sycl::queue& q,
+                   IndexT n_rows,
+                   OffsetT* row_offsets,
+                   IndexT* column_indices,
+                   ValueT* nnz_values,
+                   graph::Properties properties = graph::Properties()) {
+  using GraphT = detail::GraphCSR<Space, IndexT, OffsetT, ValueT>;
+  return GraphT{q, n_rows, row_offsets, column_indices, nnz_values, properties};
+};
+
 } // namespace build
 } // namespace graph
 } // namespace sygraph
@@ -51,6 +51,17 @@ private:
   graph::Properties _properties;
 };
 
+/**
+ * @brief Bytes of device memory held by a graph, split by the arrays that hold them.
+ */
+struct MemoryFootprint {
+  size_t csr_bytes = 0;         ///< Row offsets, column indices and values.
+  size_t inverse_bytes = 0;     ///< Inverse graph of a directed graph, 0 when the graph is its own inverse.
+  size_t edge_source_bytes = 0; ///< Source vertex of every edge, 0 unless enabled.
+
+  size_t total() const { return csr_bytes + inverse_bytes + edge_source_bytes; }
+};
+
 namespace detail {
 
 template<typename DeviceGraphT>
@@ -4,9 +4,14 @@
  */
 #pragma once
 
+#include <algorithm>
+
 #include "sygraph/graph/graph.hpp"
 #include <sygraph/formats/csr.hpp>
+#include <sygraph/utils/device.hpp>
 #include <sygraph/utils/memory.hpp>
+#include <sygraph/utils/scan.hpp>
+#include <sygraph/utils/sort.hpp>
 
 namespace sygraph {
 namespace graph {
@@ -77,7 +82,10 @@ public:
 
   SYCL_EXTERNAL ValueT* getValues() const { return _nnz_values; }
 
+  SYCL_EXTERNAL IndexT* getEdgeSources() const { return _edge_sources; }
+
   SYCL_EXTERNAL vertex_t getSourceVertex(edge_t edge) const {
+    if (_edge_sources != nullptr) { return _edge_sources[edge]; }
     // binary search
     vertex_t low = 0;
     vertex_t high = _n_rows - 1;
@@ -140,8 +148,18 @@ public:
   IndexT* _column_indices; ///< Pointer to the column indices of the graph.
   OffsetT* _row_offsets;   ///< Pointer to the row offsets of the graph.
   ValueT* _nnz_values;     ///< Pointer to the non-zero values of the graph.
+  IndexT* _edge_sources = nullptr; ///< Source vertex of every edge, null when the sources are searched in the row offsets.
 };
 
+template<typename IndexT>
+class edge_sources_kernel;
+template<typename IndexT, typename OffsetT>
+class inverse_count_kernel;
+template<typename IndexT, typename OffsetT>
+class inverse_scatter_kernel;
+template<typename IndexT, typename OffsetT>
+class inverse_sort_kernel;
+
 template<memory::space Space, typename IndexT, typename OffsetT, typename ValueT>
 /**
  * @file graph_csr.hpp
@@ -170,11 +188,46 @@ public:
   GraphCSR(sycl::queue& q, const formats::CSR<ValueT, IndexT, OffsetT>& csr, Properties properties)
       : Graph<IndexT, OffsetT, ValueT>(properties), _queue(q), _csr(csr), _owns_inverse_graph(properties.directed) {
     initializeGraphStorage(_csr, properties);
+    if (properties.edge_sources) { buildEdgeSources(); }
   }
 
   GraphCSR(sycl::queue& q, formats::CSR<ValueT, IndexT, OffsetT>&& csr, Properties properties)
       : Graph<IndexT, OffsetT, ValueT>(properties), _queue(q), _csr(std::move(csr)), _owns_inverse_graph(properties.directed) {
     initializeGraphStorage(_csr, properties);
+    if (properties.edge_sources) { buildEdgeSources(); }
+  }
+
+  /**
+   * @brief Constructs a graph that takes ownership of CSR arrays already on the device.
+   *
+   * The arrays must be allocated in `Space` through `memory::detail::memoryAlloc`, and are released with the graph. The
+   * host copy of the CSR is read back from them, and the inverse graph of a directed graph is built on the device.
+   * @param q The SYCL queue to be used for memory operations.
+   * @param n_rows The number of vertices.
+   * @param row_offsets The `n_rows + 1` row offsets.
+   * @param column_indices The column indices, sorted within every row.
+   * @param nnz_values The edge weights.
+   * @param properties The properties of the graph.
+   */
+  GraphCSR(sycl::queue& q, IndexT n_rows, OffsetT* row_offsets, IndexT* column_indices, ValueT* nnz_values, Properties properties)
+      : Graph<IndexT, OffsetT, ValueT>(properties), _queue(q), _owns_inverse_graph(properties.directed) {
+    OffsetT n_nonzeros = 0;
+    _queue.copy(row_offsets + n_rows, &n_nonzeros, 1).wait();
+    _csr = formats::CSR<ValueT, IndexT, OffsetT>(n_rows, n_nonzeros);
+    auto e1 = _queue.copy(row_offsets, _csr.getRowOffsets().data(), n_rows + 1);
+    auto e2 = _queue.copy(column_indices, _csr.getColumnIndices().data(), n_nonzeros);
+    auto e3 = _queue.copy(nnz_values, _csr.getValues().data(), n_nonzeros);
+    e1.wait();
+    e2.wait();
+    e3.wait();
+
+    this->_device_graph = {n_rows, n_nonzeros, column_indices, row_offsets, nnz_values};
+    if (properties.directed) {
+      buildInverseOnDevice();
+    } else {
+      this->_inverse_device_graph = this->_device_graph;
+    }
+    if (properties.edge_sources) { buildEdgeSources(); }
   }
 
   GraphCSR(const GraphCSR&) = delete;
@@ -209,6 +262,76 @@ public:
 
   auto& getInverseDeviceGraph() { return _inverse_device_graph; }
 
+  /**
+   * @brief Stores the source vertex of every edge, so that `getSourceVertex` needs no binary search on the device.
+   *
+   * Enabled at construction by `Properties::edge_sources`. The array is filled on the device: every work-group copies
+   * the row offsets of its vertices to local memory and fills the segments they delimit, so hubs are spread over all
+   * the work-items of a group. Calling it again does nothing.
+   */
+  void buildEdgeSources() {
+    if (_device_graph._edge_sources != nullptr) { return; }
+    const size_t n_rows = _device_graph.getVertexCount();
+    const size_t n_edges = _device_graph.getEdgeCount();
+    IndexT* sources = memory::detail::memoryAlloc<IndexT, Space>(n_edges, _queue);
+
+    if (n_rows > 0 && n_edges > 0) {
+      const size_t local_size = sygraph::device::getProfile(_queue).compute_unit_size;
+      const size_t global_size = ((n_rows + local_size - 1) / local_size) * local_size;
+      const OffsetT* row_offsets = _device_graph.getRowOffsets();
+      _queue
+          .submit([&](sycl::handler& cgh) {
+            sycl::local_accessor<OffsetT, 1> offsets{local_size + 1, cgh};
+            cgh.parallel_for<edge_sources_kernel<IndexT>>(sycl::nd_range<1>{global_size, local_size}, [=](sycl::nd_item<1> item) {
+              const size_t lid = item.get_local_linear_id();
+              const size_t first = item.get_group_linear_id() * local_size;
+              const size_t count = std::min(local_size, n_rows - first);
+              if (lid < count) { offsets[lid] = row_offsets[first + lid]; }
+              if (lid == 0) { offsets[count] = row_offsets[first + count]; }
+              sycl::group_barrier(item.get_group());
+
+              for (OffsetT edge = offsets[0] + lid; edge < offsets[count]; edge += local_size) {
+                // the last vertex of the group whose segment starts at or before the edge
+                size_t low = 0;
+                size_t high = count;
+                while (high - low > 1) {
+                  const size_t mid = low + ((high - low) / 2);
+                  if (offsets[mid] <= edge) {
+                    low = mid;
+                  } else {
+                    high = mid;
+                  }
+                }
+                sources[edge] = static_cast<IndexT>(first + low);
+              }
+            });
+          })
+          .wait_and_throw();
+    }
+
+    _device_graph._edge_sources = sources;
+    if (!_owns_inverse_graph) { _inverse_device_graph._edge_sources = sources; }
+  }
+
+  /**
+   * @brief Returns true if the source vertex of every edge is stored.
+   */
+  bool hasEdgeSources() const { return _device_graph._edge_sources != nullptr; }
+
+  /**
+   * @brief Returns the device memory held by the graph, with the optional arrays accounted separately.
+   */
+  MemoryFootprint getMemoryFootprint() const {
+    const size_t n_rows = _device_graph.getVertexCount();
+    const size_t n_edges = _device_graph.getEdgeCount();
+    const size_t csr_bytes = (n_rows + 1) * sizeof(OffsetT) + n_edges * (sizeof(IndexT) + sizeof(ValueT));
+    MemoryFootprint footprint;
+    footprint.csr_bytes = csr_bytes;
+    footprint.inverse_bytes = _owns_inverse_graph ? csr_bytes : 0;
+    footprint.edge_source_bytes = hasEdgeSources() ? n_edges * sizeof(IndexT) : 0;
+    return footprint;
+  }
+
   /* Override superclass methods */
 
   /**
@@ -406,7 +529,12 @@ private:
     e3.wait();
 
     this->_device_graph = {n_rows, n_nonzeros, column_indices, row_offsets, nnz_values};
+    initializeInverseStorage(csr, properties);
+  }
 
+  void initializeInverseStorage(const formats::CSR<ValueT, IndexT, OffsetT>& csr, const Properties& properties) {
+    IndexT n_rows = csr.getRowOffsetsSize();
+    OffsetT n_nonzeros = csr.getNumNonzeros();
     if (properties.directed) {
       formats::CSR<ValueT, IndexT, OffsetT> inverted_csr = csr.invert();
 
@@ -425,10 +553,66 @@ private:
     }
   }
 
+  // Transposes the device arrays without a host round trip: the in-degrees are counted with atomics and scanned into
+  // the row offsets of the inverse, every edge is scattered into the row of its destination, and every row is sorted.
+  void buildInverseOnDevice() {
+    const size_t n_rows = _device_graph.getVertexCount();
+    const size_t n_nonzeros = _device_graph.getEdgeCount();
+    OffsetT* inv_row_offsets = memory::detail::memoryAlloc<OffsetT, Space>(n_rows + 1, _queue);
+    IndexT* inv_column_indices = memory::detail::memoryAlloc<IndexT, Space>(n_nonzeros, _queue);
+    ValueT* inv_nnz_values = memory::detail::memoryAlloc<ValueT, Space>(n_nonzeros, _queue);
+    OffsetT* cursors = memory::detail::memoryAlloc<OffsetT, memory::space::device>(n_rows + 1, _queue);
+    _queue.fill(cursors, OffsetT{0}, n_rows + 1).wait();
+
+    const OffsetT* row_offsets = _device_graph.getRowOffsets();
+    const IndexT* column_indices = _device_graph.getColumnIndices();
+    const ValueT* nnz_values = _device_graph.getValues();
+    if (n_nonzeros > 0) {
+      _queue
+          .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<inverse_count_kernel<IndexT, OffsetT>>(sycl::range<1>{n_nonzeros}, [=](sycl::id<1> idx) {
+              sycl::atomic_ref<OffsetT, sycl::memory_order::relaxed, sycl::memory_scope::device> count{cursors[column_indices[idx]]};
+              count.fetch_add(OffsetT{1});
+            });
+          })
+          .wait_and_throw();
+    }
+    sygraph::scan::exclusiveSum(_queue, cursors, inv_row_offsets, n_rows);
+    _queue.copy(inv_row_offsets, cursors, n_rows + 1).wait();
+
+    if (n_nonzeros > 0) {
+      _queue
+          .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<inverse_scatter_kernel<IndexT, OffsetT>>(sycl::range<1>{n_rows}, [=](sycl::id<1> idx) {
+              const size_t row = idx[0];
+              for (OffsetT edge = row_offsets[row]; edge < row_offsets[row + 1]; edge++) {
+                sycl::atomic_ref<OffsetT, sycl::memory_order::relaxed, sycl::memory_scope::device> cursor{cursors[column_indices[edge]]};
+                const OffsetT position = cursor.fetch_add(OffsetT{1});
+                inv_column_indices[position] = static_cast<IndexT>(row);
+                inv_nnz_values[position] = nnz_values[edge];
+              }
+            });
+          })
+          .wait_and_throw();
+      _queue
+          .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<inverse_sort_kernel<IndexT, OffsetT>>(sycl::range<1>{n_rows}, [=](sycl::id<1> idx) {
+              const size_t row = idx[0];
+              sygraph::sort::sortByKey(inv_column_indices + inv_row_offsets[row], inv_nnz_values + inv_row_offsets[row],
+                                       inv_row_offsets[row + 1] - inv_row_offsets[row]);
+            });
+          })
+          .wait_and_throw();
+    }
+    memory::detail::releaseUSM(cursors, _queue);
+    this->_inverse_device_graph = {static_cast<IndexT>(n_rows), static_cast<OffsetT>(n_nonzeros), inv_column_indices, inv_row_offsets, inv_nnz_values};
+  }
+
   void releaseGraphStorage(GraphCSRDevice<IndexT, OffsetT, ValueT>& graph) {
     memory::detail::releaseUSM(graph._row_offsets, _queue);
     memory::detail::releaseUSM(graph._column_indices, _queue);
     memory::detail::releaseUSM(graph._nnz_values, _queue);
+    if (graph._edge_sources != nullptr) { memory::detail::releaseUSM(graph._edge_sources, _queue); }
   }
 
   sycl::queue& _queue; ///< The SYCL queue associated with the graph.
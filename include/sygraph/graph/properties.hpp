@@ -25,10 +25,16 @@ namespace graph {
  *
  * @var Properties::weighted
  * Indicates whether the graph is weighted. If true, the graph has weights associated with its edges; otherwise, it is unweighted.
+ *
+ * @var Properties::edge_sources
+ * Stores the source vertex of every edge next to the CSR arrays, so that resolving the source of an edge is a lookup
+ * instead of a binary search over the row offsets. It costs one vertex index per edge, reported by the graph's memory
+ * footprint.
  */
 struct Properties {
   bool directed{false};
   bool weighted{false};
+  bool edge_sources{false};
 };
 
 } // namespace graph
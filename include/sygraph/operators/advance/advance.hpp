@@ -10,7 +10,10 @@
 #include <sygraph/frontier/frontier.hpp>
 #include <sygraph/frontier/frontier_settings.hpp>
 #include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/advance/automatic.hpp>
 #include <sygraph/operators/advance/bucketing.hpp>
+#include <sygraph/operators/advance/direction_optimizer.hpp>
+#include <sygraph/operators/advance/edge_mapped.hpp>
 #include <sygraph/operators/advance/workgroup_mapped.hpp>
 #include <sygraph/operators/advance/workitem_mapped.hpp>
 #include <sygraph/operators/config.hpp>
@@ -22,6 +25,24 @@ namespace operators {
 
 namespace advance {
 
+/**
+ * @brief Invokes `f.template operator()<Lb>()` with the load balancer selected at runtime.
+ *
+ * Only the load balancers that support MLB frontiers can be selected.
+ *
+ * @throws std::runtime_error If the load balancer cannot be used with MLB frontiers.
+ */
+template<typename Func>
+decltype(auto) dispatchLoadBalancer(sygraph::operators::load_balancer lb, Func&& f) {
+  switch (lb) {
+    case sygraph::operators::load_balancer::workitem_mapped: return f.template operator()<sygraph::operators::load_balancer::workitem_mapped>();
+    case sygraph::operators::load_balancer::workgroup_mapped: return f.template operator()<sygraph::operators::load_balancer::workgroup_mapped>();
+    case sygraph::operators::load_balancer::bucketing: return f.template operator()<sygraph::operators::load_balancer::bucketing>();
+    case sygraph::operators::load_balancer::automatic: return f.template operator()<sygraph::operators::load_balancer::automatic>();
+    default: throw std::runtime_error("Load balancer not supported by frontier advances");
+  }
+}
+
 /**
  * @brief Processes the vertices of a graph using a specified functor.
  *
@@ -31,6 +52,7 @@ namespace advance {
  * @tparam GraphT The type of the graph.
  * @tparam T The type of the elements in the frontier.
  * @tparam FrontierType The type of the frontier.
+ * @tparam B The bitmap word of the frontier.
  * @tparam LambdaT The type of the functor.
  * @tparam Lb The load balancer type.
  * @tparam FW The frontier view type.
@@ -48,10 +70,16 @@ template<sygraph::operators::load_balancer Lb,
          typename GraphT,
          typename LambdaT,
          typename T,
-         frontier::frontier_type FrontierType>
-sygraph::Event vertices(GraphT& graph, sygraph::frontier::Frontier<T, FrontierType>& out, LambdaT&& functor) {
+         frontier::frontier_type FrontierType,
+         typename B>
+sygraph::Event vertices(GraphT& graph, sygraph::frontier::Frontier<T, FrontierType, B>& out, LambdaT&& functor) {
   auto in = sygraph::frontier::Frontier<bool, sygraph::frontier::frontier_type::none>{};
-  if constexpr (Lb == sygraph::operators::load_balancer::workgroup_mapped) {
+  if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped) {
+    return sygraph::operators::advance::detail::workitem_mapped::
+        launchBitmapKernel<sygraph::frontier::frontier_view::graph, FW, sygraph::operators::direction::push, T>(
+            graph, in, out, std::forward<LambdaT>(functor), sygraph::frontier::size::fetch_from_memory);
+  } else if constexpr (Lb == sygraph::operators::load_balancer::workgroup_mapped
+                       || Lb == sygraph::operators::load_balancer::automatic) { // the whole graph has no frontier statistics
     return sygraph::operators::advance::detail::workgroup_mapped::
         launchBitmapKernel<sygraph::frontier::frontier_view::graph, FW, sygraph::operators::direction::push, T>(
             graph, in, out, std::forward<LambdaT>(functor), sygraph::frontier::size::fetch_from_memory);
@@ -91,7 +119,12 @@ sygraph::Event vertices(GraphT& graph, LambdaT&& functor) {
  *
  * This function processes the frontier of a graph using the specified load balancer
  * and functor. It supports different types of load balancers and invokes the appropriate
- * implementation based on the load balancer type.
+ * implementation based on the load balancer type. With `load_balancer::automatic` the implementation
+ * is chosen on every call from the degree statistics of the input frontier.
+ *
+ * With an edge input view every active edge is mapped to one work-item whatever the load balancer, and the functor
+ * receives its source, destination, index and weight. The output view selects whether the destinations or the edges
+ * themselves are inserted into the output frontier.
  *
  * @param Direction The direction of the operation (push or pull).
  * @tparam Lb The type of load balancer to use. Must be one of the values from
@@ -102,6 +135,7 @@ sygraph::Event vertices(GraphT& graph, LambdaT&& functor) {
  * @tparam LambdaT The type of the functor to apply to each element in the frontier.
  * @tparam T The type of the elements in the frontier.
  * @tparam FrontierType The type of the frontier.
+ * @tparam B The bitmap word of the frontier.
  *
  * @param graph The graph to process.
  * @param in The input frontier.
@@ -120,50 +154,209 @@ template<sygraph::operators::direction Direction,
          typename GraphT,
          typename LambdaT,
          typename T,
-         frontier::frontier_type FrontierType>
+         frontier::frontier_type FrontierType,
+         typename B>
 sygraph::Event frontier(GraphT& graph,
-                        sygraph::frontier::Frontier<T, FrontierType>& in,
-                        sygraph::frontier::Frontier<T, FrontierType>& out,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& in,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& out,
                         LambdaT&& functor,
                         frontier::size::frontier_size_t expected_size = sygraph::frontier::size::fetch_from_memory) {
-  if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped) {
+  static_assert(Direction != sygraph::operators::direction::automatic, "The automatic direction requires a DirectionOptimizer");
+  if constexpr (InView == sygraph::frontier::frontier_view::edge) {
+    return sygraph::operators::advance::detail::edge_mapped::launchBitmapKernel<OutView, Direction>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size);
+  } else if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped && FrontierType == sygraph::frontier::frontier_type::bitmap) {
     return sygraph::operators::advance::detail::workitem_mapped::frontier<InView, OutView>(graph, in, out, std::forward<LambdaT>(functor));
+  } else if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped) {
+    return sygraph::operators::advance::detail::workitem_mapped::launchBitmapKernel<InView, OutView, Direction, T>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size);
   } else if constexpr (Lb == sygraph::operators::load_balancer::workgroup_mapped) {
     return sygraph::operators::advance::detail::workgroup_mapped::launchBitmapKernel<InView, OutView, Direction, T>(
         graph, in, out, std::forward<LambdaT>(functor), expected_size);
   } else if constexpr (Lb == sygraph::operators::load_balancer::bucketing) {
     return sygraph::operators::advance::detail::bucketing::launchBitmapKernel<InView, OutView, Direction, T>(
         graph, in, out, std::forward<LambdaT>(functor), expected_size);
+  } else if constexpr (Lb == sygraph::operators::load_balancer::automatic) {
+    return sygraph::operators::advance::detail::automatic::launchBitmapKernel<InView, OutView, Direction, T>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size);
   } else {
     throw std::runtime_error("Load balancer not implemented");
   }
 }
 
+/**
+ * @brief Processes the frontier of a graph pushing or pulling, as chosen by a direction optimizer for this frontier.
+ *
+ * The functor has the signature of a push advance in both directions, see DirectionOptimizer.
+ *
+ * @tparam Direction Must be `direction::automatic`.
+ * @tparam Lb The load balancer type to be used, including `load_balancer::automatic`.
+ * @tparam InView The input frontier view, must be `frontier_view::vertex`.
+ * @tparam OutView The output frontier view.
+ *
+ * @param graph The graph to process.
+ * @param in The input frontier, an MLB frontier.
+ * @param out The output frontier.
+ * @param functor The functor to apply to each edge leaving the frontier.
+ * @param optimizer The state of the traversal, reset at its start.
+ *
+ * @return A `sygraph::Event` representing the completion of the frontier processing.
+ */
+template<sygraph::operators::direction Direction,
+         sygraph::operators::load_balancer Lb,
+         frontier::frontier_view InView,
+         frontier::frontier_view OutView,
+         typename GraphT,
+         typename LambdaT,
+         typename T,
+         frontier::frontier_type FrontierType,
+         typename B,
+         sygraph::operators::direction Pull,
+         frontier::frontier_view PullView,
+         bool Revisits>
+sygraph::Event frontier(GraphT& graph,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& in,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& out,
+                        LambdaT&& functor,
+                        DirectionOptimizer<Pull, PullView, Revisits>& optimizer) {
+  static_assert(Direction == sygraph::operators::direction::automatic, "A DirectionOptimizer drives only automatic advances");
+  return optimizer.template advance<Lb, InView, OutView, T>(graph, in, out, std::forward<LambdaT>(functor));
+}
+
 template<sygraph::operators::load_balancer Lb,
          frontier::frontier_view InView,
          frontier::frontier_view OutView,
          typename GraphT,
          typename LambdaT,
          typename T,
-         frontier::frontier_type FrontierType>
+         frontier::frontier_type FrontierType,
+         typename B>
 sygraph::Event frontier(GraphT& graph,
-                        sygraph::frontier::Frontier<T, FrontierType>& in,
-                        sygraph::frontier::Frontier<T, FrontierType>& out,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& in,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& out,
                         LambdaT&& functor,
                         frontier::size::frontier_size_t expected_size = sygraph::frontier::size::fetch_from_memory) {
-  if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped) {
+  if constexpr (InView == sygraph::frontier::frontier_view::edge) {
+    return sygraph::operators::advance::detail::edge_mapped::launchBitmapKernel<OutView, sygraph::operators::direction::push>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size);
+  } else if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped && FrontierType == sygraph::frontier::frontier_type::bitmap) {
     return sygraph::operators::advance::detail::workitem_mapped::frontier<InView, OutView>(graph, in, out, std::forward<LambdaT>(functor));
+  } else if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped) {
+    return sygraph::operators::advance::detail::workitem_mapped::launchBitmapKernel<InView, OutView, sygraph::operators::direction::push, T>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size);
   } else if constexpr (Lb == sygraph::operators::load_balancer::workgroup_mapped) {
     return sygraph::operators::advance::detail::workgroup_mapped::launchBitmapKernel<InView, OutView, sygraph::operators::direction::push, T>(
         graph, in, out, std::forward<LambdaT>(functor), expected_size);
   } else if constexpr (Lb == sygraph::operators::load_balancer::bucketing) {
     return sygraph::operators::advance::detail::bucketing::launchBitmapKernel<InView, OutView, sygraph::operators::direction::push, T>(
         graph, in, out, std::forward<LambdaT>(functor), expected_size);
+  } else if constexpr (Lb == sygraph::operators::load_balancer::automatic) {
+    return sygraph::operators::advance::detail::automatic::launchBitmapKernel<InView, OutView, sygraph::operators::direction::push, T>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size);
   } else {
     throw std::runtime_error("Load balancer not implemented");
   }
 }
 
+/**
+ * @brief Advances a frontier and filters the reached vertices in a single kernel.
+ *
+ * It replaces an advance into a temporary frontier followed by `filter::external`: the output frontier receives only
+ * the vertices reached through an accepted edge that also satisfy `predicate`, so the offsets of the temporary
+ * frontier are never built. The predicate runs once per accepted edge, on the vertex the edge would insert, and may
+ * therefore see a vertex more than once; predicates with side effects, such as marking the vertex as visited, must
+ * be idempotent.
+ *
+ * @tparam Direction The direction of the advance (push, pull or pull_all).
+ * @tparam Lb The load balancer type to use.
+ * @tparam InView The type of the input frontier view.
+ * @tparam OutView The type of the output frontier view.
+ *
+ * @param graph The graph to process.
+ * @param in The input frontier.
+ * @param out The output frontier, holding the vertices that passed the filter.
+ * @param functor The functor to apply to each edge, with the signature of `frontier`.
+ * @param predicate The filter, called with the vertex to insert and returning true to keep it.
+ * @param expected_size The expected number of active elements in the input frontier.
+ *
+ * @return A `sygraph::Event` representing the completion of the fused operator.
+ */
+template<sygraph::operators::direction Direction,
+         sygraph::operators::load_balancer Lb,
+         frontier::frontier_view InView,
+         frontier::frontier_view OutView,
+         typename GraphT,
+         typename LambdaT,
+         typename PredicateT,
+         typename T,
+         frontier::frontier_type FrontierType,
+         typename B>
+sygraph::Event frontier_filtered(GraphT& graph,
+                                 sygraph::frontier::Frontier<T, FrontierType, B>& in,
+                                 sygraph::frontier::Frontier<T, FrontierType, B>& out,
+                                 LambdaT&& functor,
+                                 PredicateT&& predicate,
+                                 frontier::size::frontier_size_t expected_size = sygraph::frontier::size::fetch_from_memory) {
+  static_assert(Direction != sygraph::operators::direction::automatic, "The automatic direction requires a DirectionOptimizer");
+  return frontier<Direction, Lb, InView, OutView>(
+      graph,
+      in,
+      out,
+      detail::makeFilteredFunctor<Direction>(std::forward<LambdaT>(functor), std::forward<PredicateT>(predicate)),
+      expected_size);
+}
+
+/**
+ * @brief Advances a frontier and filters the reached vertices in a single kernel, pushing or pulling as chosen by a
+ * direction optimizer. The predicate receives the candidate vertex in both directions.
+ */
+template<sygraph::operators::direction Direction,
+         sygraph::operators::load_balancer Lb,
+         frontier::frontier_view InView,
+         frontier::frontier_view OutView,
+         typename GraphT,
+         typename LambdaT,
+         typename PredicateT,
+         typename T,
+         frontier::frontier_type FrontierType,
+         typename B,
+         sygraph::operators::direction Pull,
+         frontier::frontier_view PullView,
+         bool Revisits>
+sygraph::Event frontier_filtered(GraphT& graph,
+                                 sygraph::frontier::Frontier<T, FrontierType, B>& in,
+                                 sygraph::frontier::Frontier<T, FrontierType, B>& out,
+                                 LambdaT&& functor,
+                                 PredicateT&& predicate,
+                                 DirectionOptimizer<Pull, PullView, Revisits>& optimizer) {
+  static_assert(Direction == sygraph::operators::direction::automatic, "A DirectionOptimizer drives only automatic advances");
+  // the optimizer calls the functor with the push argument order in both directions
+  return optimizer.template advance<Lb, InView, OutView, T>(
+      graph,
+      in,
+      out,
+      detail::makeFilteredFunctor<sygraph::operators::direction::push>(std::forward<LambdaT>(functor), std::forward<PredicateT>(predicate)));
+}
+
+template<sygraph::operators::load_balancer Lb,
+         frontier::frontier_view InView,
+         frontier::frontier_view OutView,
+         typename GraphT,
+         typename LambdaT,
+         typename PredicateT,
+         typename T,
+         frontier::frontier_type FrontierType,
+         typename B>
+sygraph::Event frontier_filtered(GraphT& graph,
+                                 sygraph::frontier::Frontier<T, FrontierType, B>& in,
+                                 sygraph::frontier::Frontier<T, FrontierType, B>& out,
+                                 LambdaT&& functor,
+                                 PredicateT&& predicate,
+                                 frontier::size::frontier_size_t expected_size = sygraph::frontier::size::fetch_from_memory) {
+  return frontier_filtered<sygraph::operators::direction::push, Lb, InView, OutView>(
+      graph, in, out, std::forward<LambdaT>(functor), std::forward<PredicateT>(predicate), expected_size);
+}
+
 /**
  * @brief Applies a functor to a graph's frontier using a specified load balancer and input view.
  *
@@ -178,6 +371,7 @@ sygraph::Event frontier(GraphT& graph,
  * @tparam LambdaT The type of the functor to be applied.
  * @tparam T The type of elements in the input frontier.
  * @tparam FrontierType The type of the input frontier.
+ * @tparam B The bitmap word of the input frontier.
  *
  * @param graph The graph to be processed.
  * @param in The input frontier to be processed.
@@ -193,9 +387,10 @@ template<sygraph::operators::direction Direction,
          typename GraphT,
          typename LambdaT,
          typename T,
-         frontier::frontier_type FrontierType>
+         frontier::frontier_type FrontierType,
+         typename B>
 sygraph::Event frontier(GraphT& graph,
-                        sygraph::frontier::Frontier<T, FrontierType>& in,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& in,
                         LambdaT&& functor,
                         frontier::size::frontier_size_t expected_size = sygraph::frontier::size::fetch_from_memory) {
   auto out = sygraph::frontier::Frontier<void, sygraph::frontier::frontier_type::none>{};
@@ -207,9 +402,10 @@ template<sygraph::operators::load_balancer Lb,
          typename GraphT,
          typename LambdaT,
          typename T,
-         frontier::frontier_type FrontierType>
+         frontier::frontier_type FrontierType,
+         typename B>
 sygraph::Event frontier(GraphT& graph,
-                        sygraph::frontier::Frontier<T, FrontierType>& in,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& in,
                         LambdaT&& functor,
                         frontier::size::frontier_size_t expected_size = sygraph::frontier::size::fetch_from_memory) {
   auto out = sygraph::frontier::Frontier<void, sygraph::frontier::frontier_type::none>{};
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/frontier/frontier_settings.hpp>
+#include <sygraph/operators/advance/bucketing.hpp>
+#include <sygraph/operators/advance/workgroup_mapped.hpp>
+#include <sygraph/operators/advance/workitem_mapped.hpp>
+#include <sygraph/operators/config.hpp>
+#include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/tuning.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+
+namespace sygraph {
+namespace operators {
+
+namespace advance {
+
+namespace detail {
+
+namespace automatic {
+
+/**
+ * @brief Chooses the load balancer of an advance from the degree statistics of its input frontier.
+ *
+ * Frontiers of low-degree vertices only are mapped one vertex per work-item, frontiers holding hubs go to bucketing,
+ * which splits the vertices among work-groups, sub-groups and work-items by degree, and the others to the work-group
+ * mapped balancer. The thresholds come from the tuning profile, when `0` they are the sub-group size and the
+ * work-group size of the device.
+ */
+inline sygraph::operators::load_balancer select(const sygraph::frontier::FrontierStats& stats,
+                                                const sygraph::device::DeviceProfile& profile,
+                                                const sygraph::tuning::TuningProfile& tuning) {
+  const size_t workitem_max_degree = tuning.workitem_max_degree > 0 ? tuning.workitem_max_degree : profile.sub_group_size;
+  const size_t bucketing_min_degree = tuning.bucketing_min_degree > 0 ? tuning.bucketing_min_degree : profile.compute_unit_size;
+
+  if (stats.max_degree <= workitem_max_degree) { return sygraph::operators::load_balancer::workitem_mapped; }
+  if (stats.max_degree >= bucketing_min_degree) { return sygraph::operators::load_balancer::bucketing; }
+  return sygraph::operators::load_balancer::workgroup_mapped;
+}
+
+template<sygraph::frontier::frontier_view InFW,
+         sygraph::frontier::frontier_view OutFW,
+         sygraph::operators::direction Direction,
+         typename T,
+         graph::detail::GraphConcept GraphT,
+         typename InFrontierT,
+         typename OutFrontierT,
+         typename LambdaT>
+// Builds the offsets of the input frontier together with its degree statistics, then launches the selected advance
+// on the offsets already computed.
+sygraph::Event launchBitmapKernel(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor, int expected_size) {
+  constexpr bool has_stats = requires { in.computeActiveFrontier(true, graph.getDeviceGraph()); };
+  if constexpr (InFW != sygraph::frontier::frontier_view::vertex || !has_stats) {
+    // without a frontier there are no statistics to look at
+    return workgroup_mapped::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size);
+  } else {
+    sycl::queue& q = graph.getQueue();
+    sycl::event offsets_event;
+    if constexpr (sygraph::operators::is_pull<Direction>()) {
+      offsets_event = in.computeActiveFrontier(true, graph.getInverseDeviceGraph());
+    } else {
+      offsets_event = in.computeActiveFrontier(false, graph.getDeviceGraph());
+    }
+    offsets_event.wait_and_throw();
+
+    sygraph::frontier::FrontierStats stats;
+    uint32_t active_size = 0;
+    auto in_dev_frontier = in.getDeviceFrontier();
+    auto stats_e = q.copy(in_dev_frontier.getStats(), &stats, 1);
+    auto size_e = q.copy(in_dev_frontier.getOffsetsSize(), &active_size, 1);
+    stats_e.wait();
+    size_e.wait();
+#ifdef ENABLE_PROFILING
+    sygraph::Profiler::addEvent(stats_e, "frontier_stats_fetch");
+#endif
+
+    if (expected_size == sygraph::frontier::size::fetch_from_memory) {
+      expected_size = static_cast<int>(std::max<size_t>(1, static_cast<size_t>(active_size) * in.getBitmapRange()));
+    }
+
+    switch (select(stats, sygraph::device::getProfile(q), sygraph::tuning::getProfile())) {
+      case sygraph::operators::load_balancer::workitem_mapped:
+        return workitem_mapped::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size, true);
+      case sygraph::operators::load_balancer::bucketing:
+        return bucketing::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size, true);
+      default:
+        return workgroup_mapped::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size, true);
+    }
+  }
+}
+
+} // namespace automatic
+} // namespace detail
+} // namespace advance
+} // namespace operators
+} // namespace sygraph
@@ -18,7 +18,7 @@ namespace advance {
 
 namespace detail {
 
-template<sygraph::operators::direction Direction, sygraph::frontier::frontier_view IFW, sygraph::frontier::frontier_view OFW>
+template<sygraph::operators::direction Direction, sygraph::frontier::frontier_view IFW, sygraph::frontier::frontier_view OFW, typename InFrontierDevT>
 class bucketing_advance_kernel; // needed only for naming purposes
 
 template<sygraph::frontier::frontier_view IFW,
@@ -54,6 +54,7 @@ struct BucketingContext : AdvanceContextBase<IFW, OFW, Direction, InFrontierDevT
     if constexpr (IFW == sygraph::frontier::frontier_view::vertex) {
       const uint16_t bitmap_range = this->in_dev_frontier.getBitmapRange();
       const uint32_t actual_id_offset = (state.group_offset * state.coarsening_factor) + (state.item.get_local_linear_id() / bitmap_range);
+      if (actual_id_offset >= state.offsets_size) { return this->limit; }
       const int* bitmap_offsets = this->in_dev_frontier.getOffsets();
       const auto assigned_vertex = (bitmap_offsets[actual_id_offset] * bitmap_range) + (state.item.get_local_linear_id() % bitmap_range);
       return assigned_vertex;
@@ -172,7 +173,7 @@ struct BitmapKernel {
           const auto neighbor = *n;
           if (!context.isValidNeighbor(state, neighbor)) { continue; }
           if (!functor(vertex, neighbor, edge, weight)) { continue; }
-          context.insert(state, vertex, neighbor);
+          context.insert(state, vertex, neighbor, edge);
           if (shouldShortCircuitLane()) { break; }
         }
       }
@@ -205,7 +206,7 @@ struct BitmapKernel {
                                         const uint32_t flag_index) const {
     if (!context.isValidNeighbor(state, neighbor)) { return false; }
     if (!functor(vertex, neighbor, edge, weight)) { return false; }
-    context.insert(state, vertex, neighbor);
+    context.insert(state, vertex, neighbor, edge);
     if constexpr (sygraph::operators::is_short_circuit<Direction>()) {
       sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::work_group> claimed(flags[flag_index]);
       claimed.store(1);
@@ -246,8 +247,9 @@ template<sygraph::frontier::frontier_view InFW,
          typename OutFrontierT,
          typename LambdaT>
 // Launch the mapped advance kernel for the requested frontier/configuration.
-sygraph::Event launchBitmapKernel(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor, int expected_size) {
-  auto launch = prepareAdvanceLaunch<InFW, Direction>(graph, in, out, expected_size);
+sygraph::Event
+launchBitmapKernel(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor, int expected_size, bool offsets_ready = false) {
+  auto launch = prepareAdvanceLaunch<InFW, Direction>(graph, in, out, expected_size, offsets_ready);
   const sycl::range<1>& local_range = launch.launch_config.local;
   const sycl::range<1>& global_range = launch.launch_config.global;
   const sycl::event& dependency = launch.launch_config.dependency;
@@ -255,7 +257,7 @@ sygraph::Event launchBitmapKernel(GraphT& graph, const InFrontierT& in, const Ou
   using element_t = advance_element_t<InFW, GraphT>;
   BucketingContext<InFW, OutFW, Direction, decltype(launch.in_dev_frontier), decltype(launch.out_dev_frontier)> context{
       launch.num_nodes, launch.in_dev_frontier, launch.out_dev_frontier};
-  const uint32_t max_num_subgroups = sygraph::detail::device::getMaxNumSubgroups(launch.q);
+  const uint32_t max_num_subgroups = sygraph::device::getProfile(launch.q).max_num_sub_groups;
   using bitmap_kernel_t = BitmapKernel<InFW, OutFW, Direction, element_t, decltype(context), decltype(launch.graph_dev), LambdaT>;
 
   auto e = launch.q.submit([&](sycl::handler& cgh) {
@@ -273,21 +275,22 @@ sygraph::Event launchBitmapKernel(GraphT& graph, const InFrontierT& in, const Ou
     sycl::local_accessor<uint32_t, 1> workgroup_ids{local_range, cgh};
     sycl::local_accessor<uint32_t, 1> workgroup_claimed{local_range, cgh};
 
-    cgh.parallel_for<bucketing_advance_kernel<Direction, InFW, OutFW>>(sycl::nd_range<1>{global_range, local_range},
-                                                                       bitmap_kernel_t{context,
-                                                                                       launch.graph_dev,
-                                                                                       n_edges_wg,
-                                                                                       n_edges_sg,
-                                                                                       visited,
-                                                                                       subgroup_reduce,
-                                                                                       subgroup_reduce_tail,
-                                                                                       subgroup_ids,
-                                                                                       subgroup_claimed,
-                                                                                       workgroup_reduce,
-                                                                                       workgroup_reduce_tail,
-                                                                                       workgroup_ids,
-                                                                                       workgroup_claimed,
-                                                                                       std::forward<LambdaT>(functor)});
+    using kernel_name_t = bucketing_advance_kernel<Direction, InFW, OutFW, decltype(launch.in_dev_frontier)>;
+    cgh.parallel_for<kernel_name_t>(sycl::nd_range<1>{global_range, local_range},
+                                    bitmap_kernel_t{context,
+                                                    launch.graph_dev,
+                                                    n_edges_wg,
+                                                    n_edges_sg,
+                                                    visited,
+                                                    subgroup_reduce,
+                                                    subgroup_reduce_tail,
+                                                    subgroup_ids,
+                                                    subgroup_claimed,
+                                                    workgroup_reduce,
+                                                    workgroup_reduce_tail,
+                                                    workgroup_ids,
+                                                    workgroup_claimed,
+                                                    std::forward<LambdaT>(functor)});
   });
   return {e};
 }
@@ -4,6 +4,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
 
 #include <sycl/sycl.hpp>
@@ -51,6 +52,8 @@ struct AdvanceContextBase {
       return vertex < limit && ((Direction == sygraph::operators::direction::push) == in_dev_frontier.check(vertex));
     } else if constexpr (IFW == sygraph::frontier::frontier_view::graph) {
       return vertex < limit;
+    } else if constexpr (IFW == sygraph::frontier::frontier_view::edge) {
+      return vertex < limit && in_dev_frontier.check(vertex); // `vertex` is an edge, `limit` the edge count
     } else {
       return false;
     }
@@ -64,13 +67,16 @@ struct AdvanceContextBase {
     }
   }
 
-  SYCL_EXTERNAL inline void insert(const AdvanceContextState&, const uint32_t& vertex, const uint32_t& neighbor) const {
+  // an edge frontier receives the index of the accepted edge, in the inverse graph when pulling
+  SYCL_EXTERNAL inline void insert(const AdvanceContextState&, const uint32_t& vertex, const uint32_t& neighbor, const uint32_t& edge) const {
     if constexpr (OFW == sygraph::frontier::frontier_view::vertex) {
       if constexpr (!sygraph::operators::is_pull<Direction>()) {
         out_dev_frontier.insert(neighbor);
       } else {
         out_dev_frontier.insert(vertex);
       }
+    } else if constexpr (OFW == sygraph::frontier::frontier_view::edge) {
+      out_dev_frontier.insert(edge);
     }
   }
 };
@@ -86,17 +92,24 @@ struct AdvanceLaunchSetup {
   sygraph::detail::kernel::LaunchConfig launch_config;
 };
 
+// `offsets_ready` tells that the offsets of the input frontier were already computed for this advance
 template<sygraph::frontier::frontier_view InFW, typename GraphT, typename InFrontierT>
-inline sygraph::detail::kernel::LaunchConfig
-buildAdvanceLaunchConfig(GraphT& graph, const InFrontierT& in, bool pull_advance, int expected_size, size_t coarsening_factor, sycl::queue& q) {
+inline sygraph::detail::kernel::LaunchConfig buildAdvanceLaunchConfig(GraphT& graph,
+                                                                      const InFrontierT& in,
+                                                                      bool pull_advance,
+                                                                      int expected_size,
+                                                                      size_t coarsening_factor,
+                                                                      sycl::queue& q,
+                                                                      bool offsets_ready = false) {
   sygraph::detail::kernel::LaunchConfig config{};
   auto in_dev_frontier = in.getDeviceFrontier();
-  if constexpr (InFW == sygraph::frontier::frontier_view::vertex) {
+  // vertex and edge frontiers are both launched over the active words of their bitmap
+  if constexpr (InFW == sygraph::frontier::frontier_view::vertex || InFW == sygraph::frontier::frontier_view::edge) {
     const size_t bitmap_range = in.getBitmapRange();
     config.local = {bitmap_range * coarsening_factor};
     uint32_t active_size = 0;
     if constexpr (requires { in.computeActiveFrontier(pull_advance); }) {
-      config.dependency = in.computeActiveFrontier(pull_advance);
+      if (!offsets_ready) { config.dependency = in.computeActiveFrontier(pull_advance); }
     } else {
       active_size = static_cast<uint32_t>(in.computeActiveFrontier());
     }
@@ -107,7 +120,7 @@ buildAdvanceLaunchConfig(GraphT& graph, const InFrontierT& in, bool pull_advance
     } else if (expected_size == frontier::size::infer_from_device) {
       // `coarsening_factor` is already encoded in the work-group width:
       // each work-group covers `coarsening_factor` bitmap-offset integers.
-      requested_global = config.local[0] * sygraph::detail::device::getNumComputeUnits(q);
+      requested_global = config.local[0] * sygraph::device::getProfile(q).num_compute_units;
     } else if (expected_size == frontier::size::fetch_from_memory) {
       if constexpr (requires { in.computeActiveFrontier(pull_advance); }) {
         config.dependency.wait_and_throw();
@@ -124,7 +137,7 @@ buildAdvanceLaunchConfig(GraphT& graph, const InFrontierT& in, bool pull_advance
 
     config.global = {sygraph::detail::kernel::ensureLocalMultiple(requested_global, config.local[0])};
   } else if constexpr (InFW == sygraph::frontier::frontier_view::graph) {
-    config.local = {types::detail::COMPUTE_UNIT_SIZE};
+    config.local = {sygraph::device::getProfile(q).compute_unit_size};
     const size_t requested_global = graph.getVertexCount();
     config.global = {sygraph::detail::kernel::ensureLocalMultiple(requested_global, config.local[0])};
   } else {
@@ -139,21 +152,41 @@ template<sygraph::frontier::frontier_view InFW,
          graph::detail::GraphConcept GraphT,
          typename InFrontierT,
          typename OutFrontierT>
-inline auto prepareAdvanceLaunch(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, int expected_size) {
+inline auto prepareAdvanceLaunch(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, int expected_size, bool offsets_ready = false) {
   sycl::queue& q = graph.getQueue();
   auto in_dev_frontier = in.getDeviceFrontier();
   auto out_dev_frontier = out.getDeviceFrontier();
   auto graph_dev = graph.getDeviceGraph();
   if constexpr (sygraph::operators::is_pull<Direction>()) { graph_dev = graph.getInverseDeviceGraph(); }
 
-  const size_t coarsening_factor = types::detail::COMPUTE_UNIT_SIZE / sygraph::detail::device::getSubgroupSize(q);
+  const auto& profile = sygraph::device::getProfile(q);
+  size_t coarsening_factor = std::max<size_t>(1, profile.compute_unit_size / profile.sub_group_size);
+  if constexpr (InFW == sygraph::frontier::frontier_view::vertex || InFW == sygraph::frontier::frontier_view::edge) {
+    // a work-group spans `bitmap range * coarsening_factor` work-items, which must not exceed the device limit
+    coarsening_factor = std::min<size_t>(coarsening_factor, std::max<size_t>(1, profile.max_work_group_size / in.getBitmapRange()));
+  }
   const bool pull_advance = sygraph::operators::is_pull<Direction>();
-  auto launch_config = buildAdvanceLaunchConfig<InFW>(graph, in, pull_advance, expected_size, coarsening_factor, q);
+  auto launch_config = buildAdvanceLaunchConfig<InFW>(graph, in, pull_advance, expected_size, coarsening_factor, q, offsets_ready);
 
   return AdvanceLaunchSetup<decltype(graph_dev), decltype(in_dev_frontier), decltype(out_dev_frontier)>{
       q, graph.getVertexCount(), in_dev_frontier, out_dev_frontier, graph_dev, coarsening_factor, launch_config};
 }
 
+// Joins the edge functor of a fused advance with the vertex predicate of its filter: an edge is accepted only if the
+// vertex it would insert into the output frontier, the destination when pushing and the source when pulling, passes.
+template<sygraph::operators::direction Direction, typename LambdaT, typename PredicateT>
+inline auto makeFilteredFunctor(LambdaT&& functor, PredicateT&& predicate) {
+  return [functor = std::decay_t<LambdaT>(functor),
+          predicate = std::decay_t<PredicateT>(predicate)](auto src, auto dst, auto edge, auto weight) -> bool {
+    if (!functor(src, dst, edge, weight)) { return false; }
+    if constexpr (sygraph::operators::is_pull<Direction>()) {
+      return predicate(src);
+    } else {
+      return predicate(dst);
+    }
+  };
+}
+
 template<sygraph::frontier::frontier_view InFW, typename GraphT>
 using advance_element_t = std::conditional_t<InFW == sygraph::frontier::frontier_view::vertex, typename GraphT::vertex_t, typename GraphT::edge_t>;
 
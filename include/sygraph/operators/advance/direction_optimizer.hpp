@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/frontier/frontier_settings.hpp>
+#include <sygraph/operators/advance/automatic.hpp>
+#include <sygraph/operators/advance/bucketing.hpp>
+#include <sygraph/operators/advance/workgroup_mapped.hpp>
+#include <sygraph/operators/advance/workitem_mapped.hpp>
+#include <sygraph/operators/config.hpp>
+#include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/memory.hpp>
+#include <sygraph/utils/tuning.hpp>
+#ifdef ENABLE_PROFILING
+#include <sygraph/utils/profiler.hpp>
+#endif
+
+namespace sygraph {
+namespace operators {
+
+namespace advance {
+
+namespace detail {
+
+/**
+ * @brief State of a direction-optimizing traversal, kept on the device between advances.
+ */
+struct DirectionState {
+  uint64_t unexplored_edges = 0;          ///< Edges not yet reached by the traversal.
+  uint32_t push = 1;                      ///< Direction of the current advance, 1 for push.
+  uint32_t offsets_size = 0;              ///< Active words of the input frontier.
+  uint32_t arrived = 0;                   ///< Work-groups of the statistics pass done with the current frontier.
+  sygraph::frontier::FrontierStats stats; ///< Statistics of the input frontier.
+};
+
+/**
+ * @brief Chooses the direction of the next advance from the last work-group of the pass computing the frontier
+ * statistics, so the choice needs no launch of its own.
+ */
+template<bool Revisits>
+struct DirectionUpdate {
+  DirectionState* state;
+  float alpha;
+  float beta;
+  size_t num_vertices;
+
+  void operator()(const sygraph::frontier::FrontierStats* stats, const uint32_t* offsets_size, size_t num_groups) const {
+    sycl::atomic_ref<uint32_t, sycl::memory_order::acq_rel, sycl::memory_scope::device> arrived(state->arrived);
+    if (arrived.fetch_add(1) != num_groups - 1) { return; }
+    arrived.store(0);
+
+    state->stats = *stats;
+    state->offsets_size = offsets_size[0];
+    if (state->push) {
+      state->push = static_cast<float>(stats->degree_sum) > static_cast<float>(state->unexplored_edges) / alpha ? 0 : 1;
+    } else {
+      state->push = static_cast<float>(stats->active_elements) < static_cast<float>(num_vertices) / beta ? 1 : 0;
+    }
+    // a frontier of a traversal that revisits vertices holds edges explored before, the count would drop to 0
+    if constexpr (!Revisits) {
+      state->unexplored_edges = state->unexplored_edges > stats->degree_sum ? state->unexplored_edges - stats->degree_sum : 0;
+    }
+  }
+};
+
+template<sygraph::operators::load_balancer Lb,
+         sygraph::frontier::frontier_view InFW,
+         sygraph::frontier::frontier_view OutFW,
+         sygraph::operators::direction Direction,
+         typename T,
+         graph::detail::GraphConcept GraphT,
+         typename InFrontierT,
+         typename OutFrontierT,
+         typename LambdaT>
+// Launches the advance of a load balancer on offsets that may already be computed. With `automatic` and known
+// statistics the balancer is picked here, otherwise the automatic advance gathers them itself.
+sygraph::Event launchAdvance(GraphT& graph,
+                             const InFrontierT& in,
+                             const OutFrontierT& out,
+                             LambdaT&& functor,
+                             int expected_size,
+                             bool offsets_ready,
+                             const sygraph::frontier::FrontierStats* stats) {
+  if constexpr (Lb == sygraph::operators::load_balancer::automatic) {
+    if (!offsets_ready || stats == nullptr) {
+      return automatic::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size);
+    }
+    switch (automatic::select(*stats, sygraph::device::getProfile(graph.getQueue()), sygraph::tuning::getProfile())) {
+      case sygraph::operators::load_balancer::workitem_mapped:
+        return workitem_mapped::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size, true);
+      case sygraph::operators::load_balancer::bucketing:
+        return bucketing::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size, true);
+      default:
+        return workgroup_mapped::launchBitmapKernel<InFW, OutFW, Direction, T>(graph, in, out, std::forward<LambdaT>(functor), expected_size, true);
+    }
+  } else if constexpr (Lb == sygraph::operators::load_balancer::workitem_mapped) {
+    return workitem_mapped::launchBitmapKernel<InFW, OutFW, Direction, T>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size, offsets_ready);
+  } else if constexpr (Lb == sygraph::operators::load_balancer::workgroup_mapped) {
+    return workgroup_mapped::launchBitmapKernel<InFW, OutFW, Direction, T>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size, offsets_ready);
+  } else if constexpr (Lb == sygraph::operators::load_balancer::bucketing) {
+    return bucketing::launchBitmapKernel<InFW, OutFW, Direction, T>(
+        graph, in, out, std::forward<LambdaT>(functor), expected_size, offsets_ready);
+  } else {
+    throw std::runtime_error("Load balancer not implemented");
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Chooses between push and pull on every advance of a traversal, using the alpha/beta heuristic of
+ * direction-optimizing BFS.
+ *
+ * The input frontier size and degree sum come from the pass that builds its offsets, whose last work-group also
+ * takes the decision and decreases the count of unexplored edges by the degree sum of the frontier, so every advance
+ * costs a single read-back of the state and no whole-graph reduction is needed. A push advance switches to pull when the
+ * frontier degree exceeds `unexplored edges / alpha`, a pull advance switches back when the frontier holds fewer than
+ * `vertices / beta` vertices.
+ *
+ * In pull steps the functor is called with the same argument order as in push steps: the first vertex belongs to the
+ * input frontier and the second is the candidate for the output frontier. The edge index refers to the inverse graph.
+ *
+ * @tparam Pull The pull kernel: `direction::pull` stops at the first accepted edge of a vertex, which suits traversals
+ * that reach every vertex once (BFS), `direction::pull_all` reads all of them (relaxations such as SSSP or sigma
+ * accumulation).
+ * @tparam PullView `frontier_view::vertex` pulls only into the vertices outside the input frontier,
+ * `frontier_view::graph` into all vertices, for traversals where a frontier vertex can still be updated.
+ * @tparam Revisits True for traversals that add a vertex to the frontier more than once (SSSP, CC, BC). Their frontier
+ * degrees are not subtracted from the unexplored edges, which stay at the edge count of the graph.
+ */
+template<sygraph::operators::direction Pull = sygraph::operators::direction::pull,
+         sygraph::frontier::frontier_view PullView = sygraph::frontier::frontier_view::vertex,
+         bool Revisits = false>
+class DirectionOptimizer {
+  static_assert(sygraph::operators::is_pull<Pull>(), "The pull kernel must be direction::pull or direction::pull_all");
+  static_assert(PullView == sygraph::frontier::frontier_view::vertex || PullView == sygraph::frontier::frontier_view::graph,
+                "Pull advances run on the vertices outside the frontier or on the whole graph");
+
+public:
+  /**
+   * @brief Allocates the device state of the optimizer for a graph. The thresholds default to the tuning profile.
+   */
+  template<typename GraphT>
+  DirectionOptimizer(GraphT& graph, std::optional<float> alpha = {}, std::optional<float> beta = {})
+      : _queue(graph.getQueue()), _num_vertices(graph.getVertexCount()), _num_edges(graph.getEdgeCount()) {
+    _state = memory::detail::memoryAlloc<detail::DirectionState, memory::space::device>(1, _queue);
+    reset(alpha, beta);
+  }
+
+  DirectionOptimizer(const DirectionOptimizer&) = delete;
+  DirectionOptimizer& operator=(const DirectionOptimizer&) = delete;
+
+  ~DirectionOptimizer() { memory::detail::releaseUSM(_state, _queue); }
+
+  /**
+   * @brief Starts a new traversal: every edge is unexplored and the next advance is evaluated from push.
+   */
+  void reset(std::optional<float> alpha = {}, std::optional<float> beta = {}) {
+    const auto& tuning = sygraph::tuning::getProfile();
+    _alpha = alpha.value_or(tuning.bfs_alpha);
+    _beta = beta.value_or(tuning.bfs_beta);
+    _host_state = detail::DirectionState{};
+    _host_state.unexplored_edges = _num_edges;
+    _queue.copy(&_host_state, _state, 1).wait();
+  }
+
+  /**
+   * @brief Returns true if the last advance was a push.
+   */
+  bool isPush() const { return _host_state.push != 0; }
+
+  /**
+   * @brief Returns the edges left unexplored after the last advance.
+   */
+  size_t getUnexploredEdges() const { return _host_state.unexplored_edges; }
+
+  /**
+   * @brief Runs one advance in the direction chosen for the input frontier.
+   */
+  template<sygraph::operators::load_balancer Lb,
+           sygraph::frontier::frontier_view InFW,
+           sygraph::frontier::frontier_view OutFW,
+           typename T,
+           graph::detail::GraphConcept GraphT,
+           typename InFrontierT,
+           typename OutFrontierT,
+           typename LambdaT>
+  sygraph::Event advance(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor) {
+    static_assert(InFW == sygraph::frontier::frontier_view::vertex, "The direction-optimizing advance requires a vertex frontier.");
+    static_assert(requires { in.computeActiveFrontier(false, graph.getDeviceGraph()); },
+                  "The direction-optimizing advance requires an MLB frontier.");
+
+    auto offsets_e = in.computeActiveFrontier(false, graph.getDeviceGraph(), detail::DirectionUpdate<Revisits>{_state, _alpha, _beta, _num_vertices});
+    _queue.copy(_state, &_host_state, 1, offsets_e).wait_and_throw();
+
+    if (_host_state.push) {
+      const int expected_size = static_cast<int>(std::max<size_t>(1, static_cast<size_t>(_host_state.offsets_size) * in.getBitmapRange()));
+      return detail::launchAdvance<Lb, InFW, OutFW, sygraph::operators::direction::push, T>(
+          graph, in, out, std::forward<LambdaT>(functor), expected_size, true, &_host_state.stats);
+    }
+    auto pull_functor = [functor = std::decay_t<LambdaT>(functor)](auto vertex, auto neighbor, auto edge, auto weight) -> bool {
+      return functor(neighbor, vertex, edge, weight);
+    };
+    return detail::launchAdvance<Lb, PullView, OutFW, Pull, T>(
+        graph, in, out, std::move(pull_functor), sygraph::frontier::size::fetch_from_memory, false, nullptr);
+  }
+
+private:
+  sycl::queue& _queue;
+  size_t _num_vertices;
+  size_t _num_edges;
+  float _alpha = 1.0f;
+  float _beta = 1.0f;
+  detail::DirectionState* _state;
+  detail::DirectionState _host_state;
+};
+
+} // namespace advance
+} // namespace operators
+} // namespace sygraph
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/advance/common.hpp>
+#include <sygraph/operators/config.hpp>
+#include <sygraph/sycl/event.hpp>
+
+namespace sygraph {
+namespace operators {
+
+namespace advance {
+
+namespace detail {
+
+template<sygraph::frontier::frontier_view OFW, typename InFrontierDevT>
+class edge_mapped_advance_kernel; // needed only for naming purposes
+
+template<sygraph::frontier::frontier_view OutFW, typename ContextT, graph::detail::DeviceGraphConcept GraphDevT, typename LambdaT>
+// Maps every active edge of an edge frontier to a single work-item. Every element carries exactly one edge of work,
+// so there is no degree imbalance to correct and the load balancer of the advance is irrelevant.
+struct EdgeMappedBitmapKernel {
+  // Entry point invoked by the SYCL runtime for each work-item.
+  void operator()(sycl::nd_item<1> item) const {
+    const AdvanceContextState state{0, 1, 0, item};
+    const uint32_t bitmap_range = context.in_dev_frontier.getBitmapRange();
+    const size_t num_elements = static_cast<size_t>(context.in_dev_frontier.getOffsetsSize()[0]) * bitmap_range;
+
+    for (size_t id = item.get_global_linear_id(); id < num_elements; id += item.get_global_range(0)) {
+      const uint32_t edge = (context.in_dev_frontier.getOffsets()[id / bitmap_range] * bitmap_range) + (id % bitmap_range);
+      if (!context.check(state, edge)) { continue; }
+
+      const auto source = graph_dev.getSourceVertex(edge);
+      const auto neighbor = graph_dev.getDestinationVertex(edge);
+      const auto weight = graph_dev.getEdgeWeight(edge);
+      if (!functor(source, neighbor, edge, weight)) { continue; }
+      context.insert(state, source, neighbor, edge);
+    }
+  }
+
+  const ContextT context;
+  const GraphDevT graph_dev;
+  const LambdaT functor;
+};
+
+namespace edge_mapped {
+
+template<sygraph::frontier::frontier_view OutFW,
+         sygraph::operators::direction Direction,
+         graph::detail::GraphConcept GraphT,
+         typename InFrontierT,
+         typename OutFrontierT,
+         typename LambdaT>
+// Launch the edge-mapped advance on an edge frontier. The output frontier receives the destination of every accepted
+// edge with a vertex view, or the edge itself with an edge view.
+sygraph::Event launchBitmapKernel(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor, int expected_size) {
+  static_assert(Direction == sygraph::operators::direction::push, "Edge frontiers are advanced in the push direction only.");
+  auto launch = prepareAdvanceLaunch<sygraph::frontier::frontier_view::edge, Direction>(graph, in, out, expected_size);
+  const sycl::range<1>& local_range = launch.launch_config.local;
+  const sycl::range<1>& global_range = launch.launch_config.global;
+  const sycl::event& dependency = launch.launch_config.dependency;
+
+  AdvanceContextBase<sygraph::frontier::frontier_view::edge, OutFW, Direction, decltype(launch.in_dev_frontier), decltype(launch.out_dev_frontier)>
+      context{graph.getEdgeCount(), launch.in_dev_frontier, launch.out_dev_frontier};
+  using bitmap_kernel_t = EdgeMappedBitmapKernel<OutFW, decltype(context), decltype(launch.graph_dev), LambdaT>;
+
+  auto e = launch.q.submit([&](sycl::handler& cgh) {
+    cgh.depends_on(dependency);
+    cgh.parallel_for<edge_mapped_advance_kernel<OutFW, decltype(launch.in_dev_frontier)>>(
+        sycl::nd_range<1>{global_range, local_range}, bitmap_kernel_t{context, launch.graph_dev, std::forward<LambdaT>(functor)});
+  });
+  return {e};
+}
+
+} // namespace edge_mapped
+} // namespace detail
+} // namespace advance
+} // namespace operators
+} // namespace sygraph
@@ -32,7 +32,7 @@ SYCL_EXTERNAL inline uint32_t workgroupMappedUpperBound(const T* values, uint32_
   return left;
 }
 
-template<sygraph::operators::direction Direction, sygraph::frontier::frontier_view IFW, sygraph::frontier::frontier_view OFW>
+template<sygraph::operators::direction Direction, sygraph::frontier::frontier_view IFW, sygraph::frontier::frontier_view OFW, typename InFrontierDevT>
 class workgroup_mapped_advance_kernel; // needed only for naming purposes
 
 template<sygraph::frontier::frontier_view IFW,
@@ -166,7 +166,7 @@ struct WorkgroupMappedBitmapKernel {
                                         const uint32_t slot) const {
     if (!context.isValidNeighbor(state, neighbor)) { return false; }
     if (!functor(source, neighbor, edge, weight)) { return false; }
-    context.insert(state, source, neighbor);
+    context.insert(state, source, neighbor, edge);
     if constexpr (sygraph::operators::is_short_circuit<Direction>()) {
       sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::work_group> slot_done(source_done[slot]);
       slot_done.store(1);
@@ -186,8 +186,9 @@ template<sygraph::frontier::frontier_view InFW,
          typename OutFrontierT,
          typename LambdaT>
 // Launch the mapped advance kernel for the requested frontier/configuration.
-sygraph::Event launchBitmapKernel(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor, int expected_size) {
-  auto launch = prepareAdvanceLaunch<InFW, Direction>(graph, in, out, expected_size);
+sygraph::Event
+launchBitmapKernel(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor, int expected_size, bool offsets_ready = false) {
+  auto launch = prepareAdvanceLaunch<InFW, Direction>(graph, in, out, expected_size, offsets_ready);
   const sycl::range<1>& local_range = launch.launch_config.local;
   const sycl::range<1>& global_range = launch.launch_config.global;
   const sycl::event& dependency = launch.launch_config.dependency;
@@ -205,7 +206,7 @@ sygraph::Event launchBitmapKernel(GraphT& graph, const InFrontierT& in, const Ou
     sycl::local_accessor<uint32_t, 1> scan_ends{local_range, cgh};
     sycl::local_accessor<uint32_t, 1> source_done{local_range, cgh};
 
-    cgh.parallel_for<workgroup_mapped_advance_kernel<Direction, InFW, OutFW>>(
+    cgh.parallel_for<workgroup_mapped_advance_kernel<Direction, InFW, OutFW, decltype(launch.in_dev_frontier)>>(
         sycl::nd_range<1>{global_range, local_range},
         bitmap_kernel_t{context, launch.graph_dev, vertices, start_edges, scan_begins, scan_ends, source_done, std::forward<LambdaT>(functor)});
   });
@@ -8,7 +8,9 @@
 #include <sycl/sycl.hpp>
 
 #include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/advance/common.hpp>
 #include <sygraph/operators/config.hpp>
+#include <sygraph/sycl/event.hpp>
 #include <sygraph/utils/types.hpp>
 
 namespace sygraph {
@@ -18,6 +20,55 @@ namespace advance {
 
 namespace detail {
 
+template<sygraph::operators::direction Direction, sygraph::frontier::frontier_view IFW, sygraph::frontier::frontier_view OFW, typename InFrontierDevT>
+class workitem_mapped_advance_kernel; // needed only for naming purposes
+
+template<sygraph::frontier::frontier_view InFW,
+         sygraph::frontier::frontier_view OutFW,
+         sygraph::operators::direction Direction,
+         typename ContextT,
+         graph::detail::DeviceGraphConcept GraphDevT,
+         typename LambdaT>
+// Maps every vertex to a single work-item. It needs neither local memory nor group barriers, so it is the cheapest
+// distribution when all the vertices of the frontier have few neighbors.
+struct WorkitemMappedBitmapKernel {
+  // Entry point invoked by the SYCL runtime for each work-item.
+  void operator()(sycl::nd_item<1> item) const {
+    static_assert(InFW != sygraph::frontier::frontier_view::none, "Workitem-mapped advance requires an input frontier.");
+
+    const AdvanceContextState state{0, 1, 0, item};
+    size_t num_elements = context.limit;
+    uint32_t bitmap_range = 1;
+    if constexpr (InFW == sygraph::frontier::frontier_view::vertex) {
+      bitmap_range = context.in_dev_frontier.getBitmapRange();
+      num_elements = static_cast<size_t>(context.in_dev_frontier.getOffsetsSize()[0]) * bitmap_range;
+    }
+
+    for (size_t id = item.get_global_linear_id(); id < num_elements; id += item.get_global_range(0)) {
+      uint32_t vertex = static_cast<uint32_t>(id);
+      if constexpr (InFW == sygraph::frontier::frontier_view::vertex) {
+        vertex = (context.in_dev_frontier.getOffsets()[id / bitmap_range] * bitmap_range) + (id % bitmap_range);
+      }
+      if (!context.check(state, vertex)) { continue; }
+
+      const auto end = graph_dev.end(vertex);
+      for (auto n = graph_dev.begin(vertex); n != end; ++n) {
+        const auto edge = n.getIndex();
+        const auto weight = graph_dev.getEdgeWeight(edge);
+        const auto neighbor = *n;
+        if (!context.isValidNeighbor(state, neighbor)) { continue; }
+        if (!functor(vertex, neighbor, edge, weight)) { continue; }
+        context.insert(state, vertex, neighbor, edge);
+        if constexpr (sygraph::operators::is_short_circuit<Direction>()) { break; }
+      }
+    }
+  }
+
+  const ContextT context;
+  const GraphDevT graph_dev;
+  const LambdaT functor;
+};
+
 namespace workitem_mapped {
 
 
@@ -57,11 +108,37 @@ sygraph::Event frontier(GraphT& graph,
     });
   })};
 
-  if (!in.selfAllocated()) { sycl::free(active_elements, q); }
+  if (!in.selfAllocated()) { memory::detail::releaseUSM(active_elements, q, ret); }
   return ret;
 }
 
-// TODO implement also the graph version
+template<sygraph::frontier::frontier_view InFW,
+         sygraph::frontier::frontier_view OutFW,
+         sygraph::operators::direction Direction,
+         typename T,
+         graph::detail::GraphConcept GraphT,
+         typename InFrontierT,
+         typename OutFrontierT,
+         typename LambdaT>
+// Launch the work-item mapped advance kernel on an MLB frontier or on the whole graph.
+sygraph::Event
+launchBitmapKernel(GraphT& graph, const InFrontierT& in, const OutFrontierT& out, LambdaT&& functor, int expected_size, bool offsets_ready = false) {
+  auto launch = prepareAdvanceLaunch<InFW, Direction>(graph, in, out, expected_size, offsets_ready);
+  const sycl::range<1>& local_range = launch.launch_config.local;
+  const sycl::range<1>& global_range = launch.launch_config.global;
+  const sycl::event& dependency = launch.launch_config.dependency;
+
+  AdvanceContextBase<InFW, OutFW, Direction, decltype(launch.in_dev_frontier), decltype(launch.out_dev_frontier)> context{
+      launch.num_nodes, launch.in_dev_frontier, launch.out_dev_frontier};
+  using bitmap_kernel_t = WorkitemMappedBitmapKernel<InFW, OutFW, Direction, decltype(context), decltype(launch.graph_dev), LambdaT>;
+
+  auto e = launch.q.submit([&](sycl::handler& cgh) {
+    cgh.depends_on(dependency);
+    cgh.parallel_for<workitem_mapped_advance_kernel<Direction, InFW, OutFW, decltype(launch.in_dev_frontier)>>(
+        sycl::nd_range<1>{global_range, local_range}, bitmap_kernel_t{context, launch.graph_dev, std::forward<LambdaT>(functor)});
+  });
+  return {e};
+}
 
 } // namespace workitem_mapped
 } // namespace detail
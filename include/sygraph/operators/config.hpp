@@ -12,12 +12,14 @@ enum class load_balancer {
   subgroup_mapped,
   workgroup_mapped,
   bucketing,
+  automatic, // picks one of the above on every advance from the degree statistics of the input frontier
 };
 
 enum class direction {
   push,
   pull,      // pull with short-circuit: stops after the first valid source edge per vertex
   pull_all,  // pull without short-circuit: processes all source edges per vertex
+  automatic, // push or pull on every advance, as chosen by an advance::DirectionOptimizer
 };
 
 template<direction D>
@@ -21,7 +21,9 @@ namespace operators {
 namespace filter {
 namespace detail {
 
+template<typename FrontierDevT>
 class inplace_filter_kernel;
+template<typename FrontierDevT>
 class external_filter_kernel;
 
 template<graph::detail::GraphConcept GraphT, typename InFrontierT>
@@ -50,16 +52,18 @@ sygraph::detail::kernel::LaunchConfig buildLaunchConfig(const GraphT& graph, con
   return config;
 }
 
-template<graph::detail::GraphConcept GraphT, typename T, sygraph::frontier::frontier_type FT, typename LambdaT>
-sygraph::Event
-launchBitmapKernelExternal(GraphT& graph, const sygraph::frontier::Frontier<T, FT>& in, sygraph::frontier::Frontier<T, FT>& out, LambdaT&& functor) {
+template<graph::detail::GraphConcept GraphT, typename T, sygraph::frontier::frontier_type FT, typename B, typename LambdaT>
+sygraph::Event launchBitmapKernelExternal(GraphT& graph,
+                                          const sygraph::frontier::Frontier<T, FT, B>& in,
+                                          sygraph::frontier::Frontier<T, FT, B>& out,
+                                          LambdaT&& functor) {
   if constexpr (FT != sygraph::frontier::frontier_type::bitmap && FT != sygraph::frontier::frontier_type::mlb) {
     throw std::runtime_error("Invalid frontier type");
   }
 
   auto q = graph.getQueue();
 
-  size_t num_nodes = graph.getVertexCount();
+  size_t num_elems = in.getNumElems(); // vertices or edges, as sized by makeFrontier
 
   auto config = buildLaunchConfig(graph, in, frontier::size::fetch_from_memory, q);
 
@@ -72,7 +76,7 @@ launchBitmapKernelExternal(GraphT& graph, const sygraph::frontier::Frontier<T, F
   uint8_t bitmap_range = in_dev.getBitmapRange();
 
   sygraph::Event e = q.submit([&](sycl::handler& cgh) {
-    cgh.parallel_for<external_filter_kernel>(sycl::nd_range<1>{config.global, config.local}, [=](sycl::nd_item<1> item) {
+    cgh.parallel_for<external_filter_kernel<decltype(in_dev)>>(sycl::nd_range<1>{config.global, config.local}, [=](sycl::nd_item<1> item) {
       auto lid = item.get_local_id();
       auto group_id = item.get_group_linear_id();
       auto local_size = item.get_local_range()[0];
@@ -80,15 +84,15 @@ launchBitmapKernelExternal(GraphT& graph, const sygraph::frontier::Frontier<T, F
 
       size_t actual_id = bitmap_offsets[group_id] * bitmap_range + lid;
 
-      if (actual_id < num_nodes && in_dev.check(actual_id) && functor(actual_id)) { out_dev.insert(actual_id); }
+      if (actual_id < num_elems && in_dev.check(actual_id) && functor(actual_id)) { out_dev.insert(actual_id); }
     });
   });
 
   return e;
 }
 
-template<graph::detail::GraphConcept GraphT, typename T, sygraph::frontier::frontier_type FT, typename LambdaT>
-sygraph::Event launchBitmapKernelInplace(GraphT& graph, const sygraph::frontier::Frontier<T, FT>& frontier, LambdaT&& functor) {
+template<graph::detail::GraphConcept GraphT, typename T, sygraph::frontier::frontier_type FT, typename B, typename LambdaT>
+sygraph::Event launchBitmapKernelInplace(GraphT& graph, const sygraph::frontier::Frontier<T, FT, B>& frontier, LambdaT&& functor) {
   if constexpr (FT != sygraph::frontier::frontier_type::bitmap && FT != sygraph::frontier::frontier_type::mlb) {
     throw std::runtime_error("Invalid frontier type");
   }
@@ -96,7 +100,7 @@ sygraph::Event launchBitmapKernelInplace(GraphT& graph, const sygraph::frontier:
   auto q = graph.getQueue();
   auto dev_frontier = frontier.getDeviceFrontier();
 
-  size_t num_nodes = graph.getVertexCount();
+  size_t num_elems = frontier.getNumElems(); // vertices or edges, as sized by makeFrontier
 
   auto config = buildLaunchConfig(graph, frontier, frontier::size::fetch_from_memory, q);
 
@@ -105,7 +109,7 @@ sygraph::Event launchBitmapKernelInplace(GraphT& graph, const sygraph::frontier:
   using type_t = T;
 
   sygraph::Event e = q.submit([&](sycl::handler& cgh) {
-    cgh.parallel_for<inplace_filter_kernel>(sycl::nd_range<1>{config.global, config.local}, [=](sycl::nd_item<1> item) {
+    cgh.parallel_for<inplace_filter_kernel<decltype(dev_frontier)>>(sycl::nd_range<1>{config.global, config.local}, [=](sycl::nd_item<1> item) {
       auto lid = item.get_local_id();
       auto group_id = item.get_group_linear_id();
       auto local_size = item.get_local_range()[0];
@@ -113,7 +117,7 @@ sygraph::Event launchBitmapKernelInplace(GraphT& graph, const sygraph::frontier:
 
       size_t actual_id = bitmap_offsets[group_id] * bitmap_range + lid;
 
-      if (actual_id < num_nodes && dev_frontier.check(actual_id) && functor(actual_id)) { dev_frontier.remove(actual_id); }
+      if (actual_id < num_elems && dev_frontier.check(actual_id) && functor(actual_id)) { dev_frontier.remove(actual_id); }
     });
   });
 
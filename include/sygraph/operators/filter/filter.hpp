@@ -30,6 +30,7 @@ namespace filter {
  * @tparam GraphT The type of the graph, which must satisfy the GraphConcept.
  * @tparam T The type of the elements in the frontier.
  * @tparam FrontierType The type of the frontier.
+ * @tparam B The bitmap word of the frontier.
  * @tparam LambdaT The type of the functor to be applied.
  *
  * @param graph The graph on which the filter operation is to be performed.
@@ -38,8 +39,8 @@ namespace filter {
  *
  * @return An Event object representing the status of the filter operation.
  */
-template<graph::detail::GraphConcept GraphT, typename T, sygraph::frontier::frontier_type FrontierType, typename LambdaT>
-sygraph::Event inplace(GraphT& graph, const sygraph::frontier::Frontier<T, FrontierType>& frontier, LambdaT&& functor) {
+template<graph::detail::GraphConcept GraphT, typename T, sygraph::frontier::frontier_type FrontierType, typename B, typename LambdaT>
+sygraph::Event inplace(GraphT& graph, const sygraph::frontier::Frontier<T, FrontierType, B>& frontier, LambdaT&& functor) {
   return sygraph::operators::filter::detail::launchBitmapKernelInplace(graph, frontier, functor);
 }
 
@@ -51,6 +52,7 @@ sygraph::Event inplace(GraphT& graph, const sygraph::frontier::Frontier<T, Front
  * @tparam GraphT The type of the graph.
  * @tparam T The type of the elements in the frontier.
  * @tparam FrontierType The type of the frontier.
+ * @tparam B The bitmap word of the frontier.
  * @tparam LambdaT The type of the functor used for filtering.
  *
  * @param graph The graph on which the filter operation is performed.
@@ -60,10 +62,10 @@ sygraph::Event inplace(GraphT& graph, const sygraph::frontier::Frontier<T, Front
  *
  * @return An event representing the status of the filter operation.
  */
-template<typename GraphT, typename T, sygraph::frontier::frontier_type FrontierType, typename LambdaT>
+template<typename GraphT, typename T, sygraph::frontier::frontier_type FrontierType, typename B, typename LambdaT>
 sygraph::Event external(GraphT& graph,
-                        const sygraph::frontier::Frontier<T, FrontierType>& in,
-                        sygraph::frontier::Frontier<T, FrontierType>& out,
+                        const sygraph::frontier::Frontier<T, FrontierType, B>& in,
+                        sygraph::frontier::Frontier<T, FrontierType, B>& out,
                         LambdaT&& functor) {
   return sygraph::operators::filter::detail::launchBitmapKernelExternal(graph, in, out, functor);
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <tuple>
 #include <sycl/sycl.hpp>
 
 #include <sygraph/frontier/frontier.hpp>
@@ -12,6 +13,7 @@
 #include <sygraph/graph/graph.hpp>
 #include <sygraph/operators/advance/workitem_mapped.hpp>
 #include <sygraph/operators/config.hpp>
+#include <sygraph/operators/for/reducers.hpp>
 #include <sygraph/sycl/event.hpp>
 #include <sygraph/utils/vector.hpp>
 
@@ -22,20 +24,17 @@ namespace operators {
 
 namespace compute {
 
-template<typename T, typename R>
-concept ReducerT = std::same_as<T, sycl::plus<R>> || std::same_as<T, sycl::multiplies<R>> || std::same_as<T, sycl::minimum<R>>
-                   || std::same_as<T, sycl::maximum<R>>;
-
-
 /**
  * @brief Executes a given functor over a graph and its frontier.
  *
  * This function launches a bitmap kernel to perform computations on the graph
  * using the provided frontier and functor.
+ * With `frontier_view::edge` the frontier is an edge frontier and the functor receives edge indices.
  *
  * @tparam GraphT The type of the graph, which must satisfy the GraphConcept.
  * @tparam T The type of the elements in the frontier.
  * @tparam FrontierType The type of the frontier.
+ * @tparam B The bitmap word of the frontier.
  * @tparam LambdaT The type of the functor to be executed.
  *
  * @param graph The graph on which the computation is to be performed.
@@ -45,9 +44,9 @@ concept ReducerT = std::same_as<T, sycl::plus<R>> || std::same_as<T, sycl::multi
  *
  * @return An Event object representing the execution of the functor.
  */
-template<frontier::frontier_view FW, graph::detail::GraphConcept GraphT, typename T, typename LambdaT, frontier::frontier_type FT>
+template<frontier::frontier_view FW, graph::detail::GraphConcept GraphT, typename T, typename LambdaT, frontier::frontier_type FT, typename B>
 sygraph::Event execute(GraphT& graph,
-                       const sygraph::frontier::Frontier<T, FT>& frontier,
+                       const sygraph::frontier::Frontier<T, FT, B>& frontier,
                        LambdaT&& functor,
                        frontier::size::frontier_size_t expected_size = frontier::size::fetch_from_memory) {
   return sygraph::operators::compute::detail::launchBitmapKernel<FW>(graph, frontier, std::forward<LambdaT>(functor), expected_size);
@@ -58,13 +57,17 @@ sygraph::Event execute(GraphT& graph,
  *
  * This function launches a kernel to perform reduction operations on the graph
  * using the provided frontier, reduction operator, and accumulator.
+ * The result is combined with the value already held by the accumulator, and it is available when the function returns.
+ * The function receives the element and the reducer, which accepts `combine` for every operator.
  *
  * @tparam FW The frontier view type.
- * @tparam ReductionOperator The type of the reduction operator.
+ * @tparam ReductionOperator The type of the reduction operator: `sycl::plus`, `sycl::multiplies`, `sycl::minimum`,
+ * `sycl::maximum`, or `argmin` and `argmax` over an `ArgValue` accumulator.
  * @tparam GraphT The type of the graph, which must satisfy the GraphConcept.
  * @tparam T The type of the elements in the frontier.
  * @tparam R The type of the accumulator.
  * @tparam FT The type of the frontier.
+ * @tparam B The bitmap word of the frontier.
  * @tparam LambdaT The type of the function to be executed for reduction.
  *
  * @param graph The graph on which the reduction is to be performed.
@@ -81,14 +84,88 @@ template<frontier::frontier_view FW,
          typename T,
          typename R,
          frontier::frontier_type FT,
+         typename B,
          typename LambdaT>
   requires ReducerT<ReductionOperator, R>
 sygraph::Event reduce(GraphT& graph,
-                      const sygraph::frontier::Frontier<T, FT>& frontier,
+                      const sygraph::frontier::Frontier<T, FT, B>& frontier,
                       R& accumulator,
                       LambdaT&& function,
                       frontier::size::frontier_size_t expected_size = frontier::size::fetch_from_memory) {
-  return sygraph::operators::compute::detail::launchBitmapReduce<FW>(graph, frontier, accumulator, std::forward<LambdaT>(function), expected_size);
+  return sygraph::operators::compute::detail::launchHostReduce<FW, ReductionOperator>(
+      graph, frontier, std::tuple<R&>{accumulator}, std::forward<LambdaT>(function), expected_size);
+}
+
+/**
+ * @brief Reduces values over a graph and its frontier into device memory.
+ *
+ * Like the host reduction, but the result is combined into `accumulator`, a USM pointer, and nothing is copied back:
+ * the result is ready when the returned event completes, and later kernels can read it without a host round trip.
+ */
+template<frontier::frontier_view FW,
+         typename ReductionOperator,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename R,
+         frontier::frontier_type FT,
+         typename B,
+         typename LambdaT>
+  requires ReducerT<ReductionOperator, R>
+sygraph::Event reduce(GraphT& graph,
+                      const sygraph::frontier::Frontier<T, FT, B>& frontier,
+                      R* accumulator,
+                      LambdaT&& function,
+                      frontier::size::frontier_size_t expected_size = frontier::size::fetch_from_memory) {
+  return sygraph::operators::compute::detail::launchBitmapReduce<FW, ReductionOperator>(
+      graph, frontier, std::tuple<R*>{accumulator}, std::forward<LambdaT>(function), expected_size);
+}
+
+/**
+ * @brief Computes several reductions over a graph and its frontier in a single pass.
+ *
+ * Every accumulator of the tuple, made with `std::tie`, is reduced with the operator in the same position, and the
+ * function receives the element followed by one reducer per accumulator.
+ * The results are available when the function returns.
+ */
+template<frontier::frontier_view FW,
+         typename... ReductionOperators,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         frontier::frontier_type FT,
+         typename B,
+         typename... R,
+         typename LambdaT>
+  requires(sizeof...(ReductionOperators) == sizeof...(R) && (ReducerT<ReductionOperators, R> && ...))
+sygraph::Event reduce(GraphT& graph,
+                      const sygraph::frontier::Frontier<T, FT, B>& frontier,
+                      std::tuple<R&...> accumulators,
+                      LambdaT&& function,
+                      frontier::size::frontier_size_t expected_size = frontier::size::fetch_from_memory) {
+  return sygraph::operators::compute::detail::launchHostReduce<FW, ReductionOperators...>(
+      graph, frontier, accumulators, std::forward<LambdaT>(function), expected_size);
+}
+
+/**
+ * @brief Computes several reductions over a graph and its frontier in a single pass, into device memory.
+ *
+ * The tuple holds one USM pointer per operator; the results are ready when the returned event completes.
+ */
+template<frontier::frontier_view FW,
+         typename... ReductionOperators,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         frontier::frontier_type FT,
+         typename B,
+         typename... R,
+         typename LambdaT>
+  requires(sizeof...(ReductionOperators) == sizeof...(R) && (ReducerT<ReductionOperators, R> && ...))
+sygraph::Event reduce(GraphT& graph,
+                      const sygraph::frontier::Frontier<T, FT, B>& frontier,
+                      std::tuple<R*...> accumulators,
+                      LambdaT&& function,
+                      frontier::size::frontier_size_t expected_size = frontier::size::fetch_from_memory) {
+  return sygraph::operators::compute::detail::launchBitmapReduce<FW, ReductionOperators...>(
+      graph, frontier, accumulators, std::forward<LambdaT>(function), expected_size);
 }
 
 } // namespace compute
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <memory>
+#include <tuple>
+#include <utility>
 #include <sycl/sycl.hpp>
 
 #include <sygraph/frontier/frontier.hpp>
@@ -12,7 +14,9 @@
 #include <sygraph/graph/graph.hpp>
 #include <sygraph/operators/advance/workitem_mapped.hpp>
 #include <sygraph/operators/config.hpp>
+#include <sygraph/operators/for/reducers.hpp>
 #include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/memory.hpp>
 #include <sygraph/utils/vector.hpp>
 
 namespace sygraph {
@@ -29,7 +33,9 @@ inline sygraph::detail::kernel::LaunchConfig buildLaunchConfig(const GraphT& gra
   uint32_t active_size = 0;
   size_t requested_global = 0;
 
-  if constexpr (FW != sygraph::frontier::frontier_view::vertex) { throw std::runtime_error("Invalid frontier view for compute operation."); }
+  if constexpr (FW != sygraph::frontier::frontier_view::vertex && FW != sygraph::frontier::frontier_view::edge) {
+    throw std::runtime_error("Invalid frontier view for compute operation.");
+  }
   if (expected_size != frontier::size::fetch_from_memory) {
     throw std::runtime_error("Invalid expected_size value. Only fetch_from_memory is supported for compute operation.");
   }
@@ -50,9 +56,9 @@ inline sygraph::detail::kernel::LaunchConfig buildLaunchConfig(const GraphT& gra
   return config;
 }
 
-template<frontier::frontier_view FW, graph::detail::GraphConcept GraphT, typename T, typename LambdaT>
+template<frontier::frontier_view FW, graph::detail::GraphConcept GraphT, typename T, typename B, typename LambdaT>
 sygraph::Event launchBitmapKernel(GraphT& graph,
-                                  const sygraph::frontier::Frontier<T, frontier::frontier_type::mlb>& frontier,
+                                  const sygraph::frontier::Frontier<T, frontier::frontier_type::mlb, B>& frontier,
                                   LambdaT&& functor,
                                   int expected_size) {
   auto q = graph.getQueue();
@@ -60,7 +66,7 @@ sygraph::Event launchBitmapKernel(GraphT& graph,
 
   auto config = buildLaunchConfig<FW>(graph, frontier, expected_size, q);
 
-  size_t num_nodes = graph.getVertexCount();
+  size_t num_elems = frontier.getNumElems(); // vertices or edges, as sized by makeFrontier
   size_t bitmap_range = frontier.getBitmapRange();
 
   return q.submit([&](sycl::handler& cgh) {
@@ -72,42 +78,77 @@ sygraph::Event launchBitmapKernel(GraphT& graph,
 
       size_t actual_id = bitmap_offsets[group_id] * bitmap_range + lid;
 
-      if (actual_id < num_nodes && dev_frontier.check(actual_id)) { functor(actual_id); }
+      if (actual_id < num_elems && dev_frontier.check(actual_id)) { functor(actual_id); }
     });
   });
 }
 
-template<frontier::frontier_view FW, graph::detail::GraphConcept GraphT, typename T, typename R, typename LambdaT>
+template<frontier::frontier_view FW,
+         typename... ReductionOperators,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename B,
+         typename... R,
+         typename LambdaT>
+// Reduces the active elements of the frontier in one pass, one USM reduction per operator. The results are combined
+// with the values already held by `accumulators`, which can be device memory.
 sygraph::Event launchBitmapReduce(GraphT& graph,
-                                  const sygraph::frontier::Frontier<T, frontier::frontier_type::mlb>& frontier,
-                                  R& accumulator,
+                                  const sygraph::frontier::Frontier<T, frontier::frontier_type::mlb, B>& frontier,
+                                  std::tuple<R*...> accumulators,
                                   LambdaT&& functor,
                                   int expected_size) {
+  static_assert(sizeof...(ReductionOperators) == sizeof...(R), "Every accumulator needs a reduction operator.");
   auto q = graph.getQueue();
   auto dev_frontier = frontier.getDeviceFrontier();
 
   auto config = buildLaunchConfig<FW>(graph, frontier, expected_size, q);
 
-  size_t num_nodes = graph.getVertexCount();
+  size_t num_elems = frontier.getNumElems(); // vertices or edges, as sized by makeFrontier
   size_t bitmap_range = frontier.getBitmapRange();
 
-  sycl::buffer<R, 1> accumulator_buf(&accumulator, sycl::range<1>(1));
-  accumulator_buf.set_final_data(&accumulator);
-  accumulator_buf.set_write_back(true);
-
-  return q.submit([&](sycl::handler& cgh) {
-    auto sum_reduction = sycl::reduction<R>(accumulator_buf, cgh, sycl::plus<R>());
-    cgh.parallel_for(sycl::nd_range<1>{config.global, config.local}, sum_reduction, [=](sycl::nd_item<1> item, auto& acc) {
-      auto lid = item.get_local_id();
-      auto group_id = item.get_group_linear_id();
-      auto local_size = item.get_local_range()[0];
-      int* bitmap_offsets = dev_frontier.getOffsets();
-
-      size_t actual_id = bitmap_offsets[group_id] * bitmap_range + lid;
+  return std::apply(
+      [&](auto*... targets) {
+        return q.submit([&](sycl::handler& cgh) {
+          cgh.parallel_for(sycl::nd_range<1>{config.global, config.local},
+                           sycl::reduction(targets, reductionIdentity<ReductionOperators, R>(), ReductionOperators{})...,
+                           [=](sycl::nd_item<1> item, auto&... accs) {
+                             auto lid = item.get_local_id();
+                             auto group_id = item.get_group_linear_id();
+                             int* bitmap_offsets = dev_frontier.getOffsets();
+
+                             size_t actual_id = bitmap_offsets[group_id] * bitmap_range + lid;
+
+                             if (actual_id < num_elems && dev_frontier.check(actual_id)) { functor(actual_id, accs...); }
+                           });
+        });
+      },
+      accumulators);
+}
 
-      if (actual_id < num_nodes && dev_frontier.check(actual_id)) { functor(actual_id, acc); }
-    });
-  });
+// Runs a reduction into host accumulators through a device copy of them, and waits for the result.
+template<frontier::frontier_view FW,
+         typename... ReductionOperators,
+         graph::detail::GraphConcept GraphT,
+         typename FrontierT,
+         typename... R,
+         typename LambdaT>
+sygraph::Event launchHostReduce(GraphT& graph, const FrontierT& frontier, std::tuple<R&...> accumulators, LambdaT&& functor, int expected_size) {
+  sycl::queue& q = graph.getQueue();
+  std::tuple<R*...> targets{memory::detail::memoryAlloc<R, memory::space::device>(1, q)...};
+  [&]<size_t... I>(std::index_sequence<I...>) {
+    (q.copy(&std::get<I>(accumulators), std::get<I>(targets), 1), ...);
+    q.wait();
+  }(std::index_sequence_for<R...>{});
+
+  sygraph::Event e = launchBitmapReduce<FW, ReductionOperators...>(graph, frontier, targets, std::forward<LambdaT>(functor), expected_size);
+  e.waitAndThrow();
+
+  [&]<size_t... I>(std::index_sequence<I...>) {
+    (q.copy(std::get<I>(targets), &std::get<I>(accumulators), 1), ...);
+    q.wait();
+    (memory::detail::releaseUSM(std::get<I>(targets), q), ...);
+  }(std::index_sequence_for<R...>{});
+  return e;
 }
 
 } // namespace detail
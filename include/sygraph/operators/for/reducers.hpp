@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <concepts>
+#include <limits>
+
+#include <sycl/sycl.hpp>
+
+namespace sygraph {
+namespace operators {
+
+namespace compute {
+
+/**
+ * @brief A value with the index of the element it belongs to, the accumulator of `argmin` and `argmax`.
+ */
+template<typename V, typename I = uint32_t>
+struct ArgValue {
+  V value; ///< The value reduced.
+  I index; ///< The element holding the value, the largest index when nothing was reduced.
+
+  bool operator==(const ArgValue&) const = default;
+};
+
+/**
+ * @brief Keeps the smallest value and, among equal values, the smallest index.
+ */
+template<typename V, typename I = uint32_t>
+struct argmin {
+  ArgValue<V, I> operator()(const ArgValue<V, I>& a, const ArgValue<V, I>& b) const {
+    return (b.value < a.value || (b.value == a.value && b.index < a.index)) ? b : a;
+  }
+
+  static ArgValue<V, I> identity() { return {std::numeric_limits<V>::max(), std::numeric_limits<I>::max()}; }
+};
+
+/**
+ * @brief Keeps the largest value and, among equal values, the smallest index.
+ */
+template<typename V, typename I = uint32_t>
+struct argmax {
+  ArgValue<V, I> operator()(const ArgValue<V, I>& a, const ArgValue<V, I>& b) const {
+    return (a.value < b.value || (b.value == a.value && b.index < a.index)) ? b : a;
+  }
+
+  static ArgValue<V, I> identity() { return {std::numeric_limits<V>::lowest(), std::numeric_limits<I>::max()}; }
+};
+
+template<typename T, typename R>
+concept ReducerT = std::same_as<T, sycl::plus<R>> || std::same_as<T, sycl::multiplies<R>> || std::same_as<T, sycl::minimum<R>>
+                   || std::same_as<T, sycl::maximum<R>> || std::same_as<T, argmin<decltype(R::value), decltype(R::index)>>
+                   || std::same_as<T, argmax<decltype(R::value), decltype(R::index)>>;
+
+namespace detail {
+
+// The identity of a reduction operator, which the reductions on USM pointers need for operators without a known one.
+template<typename ReductionOperator, typename R>
+R reductionIdentity() {
+  if constexpr (std::same_as<ReductionOperator, sycl::plus<R>>) {
+    return R{};
+  } else if constexpr (std::same_as<ReductionOperator, sycl::multiplies<R>>) {
+    return R{1};
+  } else if constexpr (std::same_as<ReductionOperator, sycl::minimum<R>>) {
+    return std::numeric_limits<R>::max();
+  } else if constexpr (std::same_as<ReductionOperator, sycl::maximum<R>>) {
+    return std::numeric_limits<R>::lowest();
+  } else {
+    return ReductionOperator::identity();
+  }
+}
+
+} // namespace detail
+} // namespace compute
+} // namespace operators
+} // namespace sygraph
@@ -14,6 +14,7 @@
 #include <sygraph/utils/vector.hpp>
 
 #include <sygraph/operators/intersection/bitmap_intersect_impl.hpp>
+#include <sygraph/operators/intersection/segmented_intersect_impl.hpp>
 
 namespace sygraph {
 namespace operators {
@@ -54,6 +55,58 @@ sygraph::Event execute(GraphT& graph,
   }
 }
 
+/**
+ * @brief Intersects the adjacency lists of a batch of vertex pairs on the device.
+ *
+ * For every pair `(u, v)` the functor is called once per common neighbor `w` as `functor(u, v, index, w)`, where
+ * `index` is the position of the pair in the batch. The adjacency lists must be sorted. Each pair is intersected with
+ * the strategy that suits its degrees: lists of similar length are merged, a short list is galloped through a much
+ * longer one, and pairs whose short list is long enough to keep a work-group busy are hashed in local memory by the
+ * whole work-group. The thresholds come from the tuning profile (`intersection_gallop_ratio` and
+ * `intersection_hash_min_degree`, which defaults to the work-group size, capped to a quarter of the hash table).
+ *
+ * @param graph The graph whose adjacency lists are intersected.
+ * @param sources The first vertex of every pair, in device-accessible memory.
+ * @param destinations The second vertex of every pair, in device-accessible memory.
+ * @param count The number of pairs.
+ * @param functor The functor called for every common neighbor, concurrently for different pairs.
+ *
+ * @return An event representing the completion of the intersections.
+ * @throws std::runtime_error If the tuned `intersection_hash_min_degree` is not below half of the hash table.
+ */
+template<graph::detail::GraphConcept GraphT, typename LambdaT>
+sygraph::Event pairs(GraphT& graph,
+                     const typename GraphT::vertex_t* sources,
+                     const typename GraphT::vertex_t* destinations,
+                     size_t count,
+                     LambdaT&& functor) {
+  detail::PairArrays<typename GraphT::vertex_t> batch{sources, destinations, count};
+  return detail::launchSegmentedIntersection(graph, batch, std::forward<LambdaT>(functor));
+}
+
+/**
+ * @brief Intersects the adjacency lists of the endpoints of every edge of the graph that passes a filter.
+ *
+ * The functor is called as `functor(u, v, edge, w)` for every common neighbor `w` of the edge `(u, v)`, see `pairs`.
+ * The source of an edge is read from the edge sources of the graph when they are stored.
+ *
+ * @param graph The graph whose edges are intersected.
+ * @param functor The functor called for every common neighbor.
+ * @param filter Called as `filter(u, v)`, only the edges for which it returns true are intersected.
+ *
+ * @return An event representing the completion of the intersections.
+ * @throws std::runtime_error If the tuned `intersection_hash_min_degree` is not below half of the hash table.
+ */
+template<graph::detail::GraphConcept GraphT, typename LambdaT, typename FilterT>
+sygraph::Event edges(GraphT& graph, LambdaT&& functor, FilterT&& filter) {
+  detail::GraphEdges<typename GraphT::edge_t, std::decay_t<FilterT>> all_edges{graph.getEdgeCount(), std::forward<FilterT>(filter)};
+  return detail::launchSegmentedIntersection(graph, all_edges, std::forward<LambdaT>(functor));
+}
+
+template<graph::detail::GraphConcept GraphT, typename LambdaT>
+sygraph::Event edges(GraphT& graph, LambdaT&& functor) {
+  return edges(graph, std::forward<LambdaT>(functor), [](auto, auto) { return true; });
+}
 
 } // namespace intersection
 } // namespace operators
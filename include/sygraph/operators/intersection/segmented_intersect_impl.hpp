@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/tuning.hpp>
+
+namespace sygraph {
+namespace operators {
+namespace intersection {
+namespace detail {
+
+template<typename PairsT, typename LambdaT>
+class segmented_intersection_kernel; // needed only for naming purposes
+
+/**
+ * @brief Intersection strategies, chosen for every pair from the degrees of its two vertices.
+ */
+enum class strategy : uint32_t {
+  merge,  ///< Both lists are walked together, for lists of similar length.
+  gallop, ///< Every element of the short list is searched exponentially in the long one.
+  hash,   ///< A work-group hashes the short list in local memory and probes the long one in parallel.
+};
+
+/**
+ * @brief Degree thresholds of the strategies.
+ */
+struct IntersectionSettings {
+  size_t gallop_ratio;    ///< The long list is at least this many times longer than the short one.
+  size_t hash_min_degree; ///< The short list holds at least this many vertices.
+  size_t hash_max_degree; ///< The short list holds at most this many vertices, half of the hash table.
+  size_t table_size;      ///< Slots of the work-group hash table, a power of two.
+};
+
+/**
+ * @brief Derives the thresholds of a launch from the device and tuning profiles.
+ *
+ * The hash table holds up to 8 vertices per work-item at half load, within half of the local memory. The hash window
+ * starts at the work-group size, or at a quarter of the table when that is smaller, so that it is never empty.
+ *
+ * @throws std::runtime_error if the tuned `intersection_hash_min_degree` is not below the capacity of the table.
+ */
+template<typename VertexT>
+IntersectionSettings makeIntersectionSettings(const sygraph::device::DeviceProfile& profile, const sygraph::tuning::TuningProfile& tuning) {
+  const size_t local_size = profile.compute_unit_size;
+  const size_t table_size = std::bit_floor(std::max<size_t>(4, std::min(16 * local_size, profile.local_mem_size / (2 * sizeof(VertexT)))));
+  IntersectionSettings settings{std::max<size_t>(1, tuning.intersection_gallop_ratio),
+                                tuning.intersection_hash_min_degree > 0 ? tuning.intersection_hash_min_degree
+                                                                        : std::min(local_size, table_size / 4),
+                                table_size / 2,
+                                table_size};
+  if (settings.hash_min_degree >= settings.hash_max_degree) {
+    throw std::runtime_error("Invalid tuning profile: intersection_hash_min_degree must be below " + std::to_string(settings.hash_max_degree)
+                             + ", half of the hash table of the device");
+  }
+  return settings;
+}
+
+SYCL_EXTERNAL inline strategy selectStrategy(size_t short_degree, size_t long_degree, const IntersectionSettings& settings) {
+  if (short_degree >= settings.hash_min_degree && short_degree <= settings.hash_max_degree) { return strategy::hash; }
+  if (long_degree >= short_degree * settings.gallop_ratio) { return strategy::gallop; }
+  return strategy::merge;
+}
+
+// Pairs read from two arrays of vertices.
+template<typename VertexT>
+struct PairArrays {
+  const VertexT* sources;
+  const VertexT* destinations;
+  size_t count;
+
+  SYCL_EXTERNAL inline size_t size() const { return count; }
+
+  template<typename GraphDevT>
+  SYCL_EXTERNAL inline bool get(const GraphDevT&, size_t index, VertexT& u, VertexT& v) const {
+    u = sources[index];
+    v = destinations[index];
+    return true;
+  }
+};
+
+// Pairs formed by the endpoints of every edge of the graph that passes a filter.
+template<typename EdgeT, typename FilterT>
+struct GraphEdges {
+  size_t count;
+  FilterT filter;
+
+  SYCL_EXTERNAL inline size_t size() const { return count; }
+
+  template<typename GraphDevT, typename VertexT>
+  SYCL_EXTERNAL inline bool get(const GraphDevT& graph_dev, size_t index, VertexT& u, VertexT& v) const {
+    u = graph_dev.getSourceVertex(static_cast<EdgeT>(index));
+    v = graph_dev.getDestinationVertex(static_cast<EdgeT>(index));
+    return filter(u, v);
+  }
+};
+
+template<typename PairsT, graph::detail::DeviceGraphConcept GraphDevT, typename LambdaT>
+// Intersects the sorted adjacency lists of a batch of pairs. Every work-group takes as many pairs as work-items: each
+// work-item merges or gallops through its own pair, and the pairs with long lists are queued and intersected by the
+// whole work-group through a hash table in local memory.
+struct SegmentedIntersectionKernel {
+  using vertex_t = typename GraphDevT::vertex_t;
+  static constexpr vertex_t empty_slot = static_cast<vertex_t>(-1);
+
+  void operator()(sycl::nd_item<1> item) const {
+    const size_t lid = item.get_local_linear_id();
+    const size_t local_size = item.get_local_range(0);
+    const auto wgroup = item.get_group();
+    const size_t table_size = table.size();
+
+    for (size_t slot = lid; slot < table_size; slot += local_size) { table[slot] = empty_slot; }
+    if (wgroup.leader()) { queue_tail[0] = 0; }
+    sycl::group_barrier(wgroup);
+
+    const size_t index = item.get_global_linear_id();
+    vertex_t u = 0;
+    vertex_t v = 0;
+    if (index < pairs.size() && pairs.get(graph_dev, index, u, v)) {
+      const size_t degree_u = graph_dev.getDegree(u);
+      const size_t degree_v = graph_dev.getDegree(v);
+      const bool u_shorter = degree_u <= degree_v;
+      const vertex_t short_vertex = u_shorter ? u : v;
+      const vertex_t long_vertex = u_shorter ? v : u;
+      const size_t short_degree = u_shorter ? degree_u : degree_v;
+      const size_t long_degree = u_shorter ? degree_v : degree_u;
+
+      if (short_degree > 0) {
+        switch (selectStrategy(short_degree, long_degree, settings)) {
+          case strategy::hash: {
+            sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::work_group> tail{queue_tail[0]};
+            queue_slots[tail.fetch_add(1U)] = static_cast<uint32_t>(lid);
+            break;
+          }
+          case strategy::gallop: gallop(index, u, v, short_vertex, long_vertex); break;
+          default: merge(index, u, v); break;
+        }
+      }
+    }
+    sycl::group_barrier(wgroup);
+
+    // the queued pairs are intersected one at a time by the whole work-group
+    const uint32_t queued = queue_tail[0];
+    for (uint32_t i = 0; i < queued; i++) {
+      const size_t pair_index = item.get_group_linear_id() * local_size + queue_slots[i];
+      vertex_t pu = 0;
+      vertex_t pv = 0;
+      pairs.get(graph_dev, pair_index, pu, pv);
+      const bool u_shorter = graph_dev.getDegree(pu) <= graph_dev.getDegree(pv);
+      const vertex_t short_vertex = u_shorter ? pu : pv;
+      const vertex_t long_vertex = u_shorter ? pv : pu;
+
+      const auto short_begin = graph_dev.begin(short_vertex);
+      const size_t short_degree = graph_dev.getDegree(short_vertex);
+      for (size_t k = lid; k < short_degree; k += local_size) { insert(*(short_begin + k), table_size); }
+      sycl::group_barrier(wgroup);
+
+      const auto long_begin = graph_dev.begin(long_vertex);
+      const size_t long_degree = graph_dev.getDegree(long_vertex);
+      for (size_t k = lid; k < long_degree; k += local_size) {
+        const vertex_t w = *(long_begin + k);
+        if (contains(w, table_size)) { functor(pu, pv, pair_index, w); }
+      }
+      sycl::group_barrier(wgroup);
+
+      for (size_t slot = lid; slot < table_size; slot += local_size) { table[slot] = empty_slot; }
+      sycl::group_barrier(wgroup);
+    }
+  }
+
+  const PairsT pairs;
+  const GraphDevT graph_dev;
+  const IntersectionSettings settings;
+  const sycl::local_accessor<vertex_t, 1> table;
+  const sycl::local_accessor<uint32_t, 1> queue_slots;
+  const sycl::local_accessor<uint32_t, 1> queue_tail;
+  const LambdaT functor;
+
+  SYCL_EXTERNAL inline void merge(size_t index, vertex_t u, vertex_t v) const {
+    auto it_u = graph_dev.begin(u);
+    auto it_v = graph_dev.begin(v);
+    const auto end_u = graph_dev.end(u);
+    const auto end_v = graph_dev.end(v);
+    while (it_u != end_u && it_v != end_v) {
+      if (*it_u == *it_v) {
+        functor(u, v, index, *it_u);
+        ++it_u;
+        ++it_v;
+      } else if (*it_u < *it_v) {
+        ++it_u;
+      } else {
+        ++it_v;
+      }
+    }
+  }
+
+  SYCL_EXTERNAL inline void gallop(size_t index, vertex_t u, vertex_t v, vertex_t short_vertex, vertex_t long_vertex) const {
+    const auto long_begin = graph_dev.begin(long_vertex);
+    const size_t long_degree = graph_dev.getDegree(long_vertex);
+    size_t position = 0;
+    for (auto it = graph_dev.begin(short_vertex); it != graph_dev.end(short_vertex) && position < long_degree; ++it) {
+      const vertex_t w = *it;
+      // doubling steps bracket the first element not smaller than w, then a binary search finds it
+      size_t bound = 1;
+      while (position + bound < long_degree && *(long_begin + (position + bound)) < w) { bound *= 2; }
+      size_t low = position + (bound / 2);
+      size_t high = std::min(position + bound + 1, long_degree);
+      while (low < high) {
+        const size_t mid = low + ((high - low) / 2);
+        if (*(long_begin + mid) < w) {
+          low = mid + 1;
+        } else {
+          high = mid;
+        }
+      }
+      position = low;
+      if (position < long_degree && *(long_begin + position) == w) {
+        functor(u, v, index, w);
+        position++;
+      }
+    }
+  }
+
+  SYCL_EXTERNAL inline size_t hashSlot(vertex_t w, size_t table_size) const {
+    return (static_cast<uint32_t>(w) * 2654435761U) & (table_size - 1);
+  }
+
+  SYCL_EXTERNAL inline void insert(vertex_t w, size_t table_size) const {
+    for (size_t slot = hashSlot(w, table_size);; slot = (slot + 1) & (table_size - 1)) {
+      sycl::atomic_ref<vertex_t, sycl::memory_order::relaxed, sycl::memory_scope::work_group> entry{table[slot]};
+      vertex_t expected = empty_slot;
+      if (entry.compare_exchange_strong(expected, w) || expected == w) { return; }
+    }
+  }
+
+  SYCL_EXTERNAL inline bool contains(vertex_t w, size_t table_size) const {
+    for (size_t slot = hashSlot(w, table_size);; slot = (slot + 1) & (table_size - 1)) {
+      if (table[slot] == w) { return true; }
+      if (table[slot] == empty_slot) { return false; }
+    }
+  }
+};
+
+template<graph::detail::GraphConcept GraphT, typename PairsT, typename LambdaT>
+sygraph::Event launchSegmentedIntersection(GraphT& graph, const PairsT& pairs, LambdaT&& functor) {
+  using vertex_t = typename GraphT::vertex_t;
+  sycl::queue& q = graph.getQueue();
+  if (pairs.size() == 0) { return {sycl::event{}}; }
+
+  const auto& profile = sygraph::device::getProfile(q);
+  const auto& tuning = sygraph::tuning::getProfile();
+  const size_t local_size = profile.compute_unit_size;
+  const IntersectionSettings settings = makeIntersectionSettings<vertex_t>(profile, tuning);
+  const size_t table_size = settings.table_size;
+  const size_t global_size = ((pairs.size() + local_size - 1) / local_size) * local_size;
+  auto graph_dev = graph.getDeviceGraph();
+
+  using kernel_t = SegmentedIntersectionKernel<PairsT, decltype(graph_dev), std::decay_t<LambdaT>>;
+  sygraph::Event e = q.submit([&](sycl::handler& cgh) {
+    sycl::local_accessor<vertex_t, 1> table{table_size, cgh};
+    sycl::local_accessor<uint32_t, 1> queue_slots{local_size, cgh};
+    sycl::local_accessor<uint32_t, 1> queue_tail{1, cgh};
+    cgh.parallel_for<segmented_intersection_kernel<PairsT, std::decay_t<LambdaT>>>(
+        sycl::nd_range<1>{global_size, local_size},
+        kernel_t{pairs, graph_dev, settings, table, queue_slots, queue_tail, std::forward<LambdaT>(functor)});
+  });
+  return e;
+}
+
+} // namespace detail
+} // namespace intersection
+} // namespace operators
+} // namespace sygraph
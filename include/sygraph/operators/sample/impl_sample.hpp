@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/memory.hpp>
+#include <sygraph/utils/random.hpp>
+#include <sygraph/utils/scan.hpp>
+
+namespace sygraph {
+namespace operators {
+namespace sample {
+
+/**
+ * @brief How the neighbors of a vertex are drawn.
+ */
+enum class bias {
+  uniform, ///< Every neighbor is equally likely.
+  weighted ///< A neighbor is drawn with probability proportional to the weight of its edge, which must be positive.
+};
+
+namespace detail {
+
+class sample_seeds_kernel;   // needed only for naming purposes
+class sample_count_kernel;   // needed only for naming purposes
+class sample_collect_kernel; // needed only for naming purposes
+template<bias Bias>
+class sample_select_kernel; // needed only for naming purposes
+
+// Writes to `offsets` where the sampled edges of every vertex of a hop start, and returns how many there are.
+template<graph::detail::DeviceGraphConcept GraphDevT>
+size_t launchCount(sycl::queue& q,
+                   const GraphDevT& graph_dev,
+                   const typename GraphDevT::vertex_t* vertices,
+                   size_t num_vertices,
+                   size_t fanout,
+                   size_t* offsets) {
+  q.submit([&](sycl::handler& cgh) {
+     cgh.parallel_for<sample_count_kernel>(sycl::range<1>{num_vertices}, [=](sycl::id<1> idx) {
+       offsets[idx[0]] = std::min(graph_dev.getDegree(vertices[idx[0]]), fanout);
+     });
+   }).wait_and_throw();
+  sygraph::scan::exclusiveSum(q, offsets, offsets, num_vertices);
+  size_t total = 0;
+  q.copy(offsets + num_vertices, &total, 1).wait();
+  return total;
+}
+
+// Appends to `vertices` the flagged vertices in increasing order, moves their flags to `visited` and returns how many
+// there are. `positions` holds `num_vertices + 1` values.
+template<typename VertexT>
+size_t launchCollect(sycl::queue& q, size_t num_vertices, uint32_t* visited, uint32_t* discovered, uint32_t* positions, VertexT* vertices) {
+  sygraph::scan::exclusiveSum(q, discovered, positions, num_vertices);
+  q.submit([&](sycl::handler& cgh) {
+     cgh.parallel_for<sample_collect_kernel>(sycl::range<1>{num_vertices}, [=](sycl::id<1> idx) {
+       const size_t v = idx[0];
+       if (discovered[v] == 0) { return; }
+       vertices[positions[v]] = static_cast<VertexT>(v);
+       visited[v] = 1;
+       discovered[v] = 0;
+     });
+   }).wait_and_throw();
+  uint32_t total = 0;
+  q.copy(positions + num_vertices, &total, 1).wait();
+  return total;
+}
+
+/**
+ * @brief Samples up to `fanout` out-neighbors of every vertex of a hop, without replacement.
+ *
+ * Every edge gets a random key (Efraimidis-Spirakis: `log(u) / w` when weighted), and the edges with the largest keys
+ * form the sample, the same sample a weighted reservoir would keep. A work-group per vertex takes the whole
+ * neighborhood when it fits. Otherwise every work-item scans its share of the edges once, keeping its `fanout` largest
+ * keys sorted in local memory, and the lists are merged once: the rank of every kept key among all the lists is the
+ * slot it is written to, if below `fanout`. The work-group spans one sub-group, fewer work-items when their lists do
+ * not fit the local memory, so that the merge reads few lists. The keys are hashes of the seed, the hop and the edge,
+ * so the sample does not depend on the schedule.
+ *
+ * The sampled edges of vertex `i` are written from `offsets[i]`, and their destinations not yet in `visited` are
+ * flagged in `discovered`.
+ *
+ * @throws std::runtime_error if the list of a single work-item does not fit the local memory.
+ */
+template<bias Bias, graph::detail::DeviceGraphConcept GraphDevT>
+sygraph::Event launchSelect(sycl::queue& q,
+                            const GraphDevT& graph_dev,
+                            const typename GraphDevT::vertex_t* vertices,
+                            size_t num_vertices,
+                            const size_t* offsets,
+                            size_t fanout,
+                            uint64_t seed,
+                            uint64_t hop,
+                            const uint32_t* visited,
+                            uint32_t* discovered,
+                            typename GraphDevT::vertex_t* sources,
+                            typename GraphDevT::vertex_t* destinations,
+                            typename GraphDevT::edge_t* edges) {
+  using vertex_t = typename GraphDevT::vertex_t;
+  using edge_t = typename GraphDevT::edge_t;
+  if (fanout == 0 || num_vertices == 0) { return {sycl::event{}}; }
+  const auto& profile = sygraph::device::getProfile(q);
+  const size_t entry_bytes = sizeof(float) + sizeof(edge_t);
+  const size_t max_lanes = profile.local_mem_size / (fanout * entry_bytes);
+  if (max_lanes == 0) { throw std::runtime_error("sample: the fanout exceeds the local memory of the device"); }
+  const size_t local_size = std::bit_floor(std::max<size_t>(1, std::min<size_t>({profile.sub_group_size, profile.compute_unit_size, max_lanes})));
+  const size_t list_size = local_size * fanout;
+
+  return q.submit([&](sycl::handler& cgh) {
+    sycl::local_accessor<float, 1> list_keys{list_size, cgh};
+    sycl::local_accessor<edge_t, 1> list_edges{list_size, cgh};
+    cgh.parallel_for<sample_select_kernel<Bias>>(sycl::nd_range<1>{num_vertices * local_size, local_size}, [=](sycl::nd_item<1> item) {
+      const size_t lid = item.get_local_linear_id();
+      const vertex_t vertex = vertices[item.get_group_linear_id()];
+      const size_t out = offsets[item.get_group_linear_id()];
+      const edge_t first = graph_dev.getFirstNeighbor(vertex);
+      const size_t degree = graph_dev.getDegree(vertex);
+
+      auto emit = [=](size_t slot, edge_t edge) {
+        const vertex_t destination = graph_dev.getDestinationVertex(edge);
+        sources[out + slot] = vertex;
+        destinations[out + slot] = destination;
+        edges[out + slot] = edge;
+        if (visited[destination] == 0) {
+          sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed, sycl::memory_scope::device> flag{discovered[destination]};
+          flag.store(1U);
+        }
+      };
+
+      if (degree <= fanout) {
+        for (size_t i = lid; i < degree; i += local_size) { emit(i, first + static_cast<edge_t>(i)); }
+        return;
+      }
+
+      auto key = [=](edge_t edge) {
+        const float u = sygraph::random::uniform(seed, hop, edge);
+        if constexpr (Bias == bias::weighted) {
+          return sycl::log(u) / static_cast<float>(graph_dev.getEdgeWeight(edge));
+        } else {
+          return u;
+        }
+      };
+      // larger keys come first, ties broken by the smallest edge
+      auto precedes = [](float key_a, edge_t edge_a, float key_b, edge_t edge_b) {
+        return key_a > key_b || (key_a == key_b && edge_a < edge_b);
+      };
+
+      // every work-item keeps the largest keys of its edges, sorted
+      const size_t base = lid * fanout;
+      size_t count = 0;
+      for (size_t i = lid; i < degree; i += local_size) {
+        const edge_t edge = first + static_cast<edge_t>(i);
+        const float k = key(edge);
+        if (count == fanout && !precedes(k, edge, list_keys[base + fanout - 1], list_edges[base + fanout - 1])) { continue; }
+        size_t position = count < fanout ? count++ : fanout - 1;
+        for (; position > 0 && precedes(k, edge, list_keys[base + position - 1], list_edges[base + position - 1]); position--) {
+          list_keys[base + position] = list_keys[base + position - 1];
+          list_edges[base + position] = list_edges[base + position - 1];
+        }
+        list_keys[base + position] = k;
+        list_edges[base + position] = edge;
+      }
+      sycl::group_barrier(item.get_group());
+
+      // the rank of a kept key counts the keys of every list that precede it: the lists are sorted, so each count is a
+      // binary search, and the ranks grow along a list
+      for (size_t j = 0; j < count; j++) {
+        const float k = list_keys[base + j];
+        const edge_t edge = list_edges[base + j];
+        size_t rank = j;
+        for (size_t lane = 0; lane < local_size && rank < fanout; lane++) {
+          if (lane == lid) { continue; }
+          const size_t lane_count = std::min(fanout, (degree - std::min(degree, lane) + local_size - 1) / local_size);
+          size_t low = 0;
+          size_t high = lane_count;
+          while (low < high) {
+            const size_t mid = low + ((high - low) / 2);
+            if (precedes(list_keys[(lane * fanout) + mid], list_edges[(lane * fanout) + mid], k, edge)) {
+              low = mid + 1;
+            } else {
+              high = mid;
+            }
+          }
+          rank += low;
+        }
+        if (rank >= fanout) { break; }
+        emit(rank, edge);
+      }
+    });
+  });
+}
+
+} // namespace detail
+} // namespace sample
+} // namespace operators
+} // namespace sygraph
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/utils/memory.hpp>
+
+#include <sygraph/operators/sample/impl_sample.hpp>
+
+namespace sygraph {
+namespace operators {
+
+/**
+ * @namespace sample
+ * Random sampling of neighborhoods, for mini-batch training of graph neural networks.
+ */
+namespace sample {
+
+/**
+ * @class SampledSubgraph
+ * @brief The edges drawn by a neighbor sampling, in COO format in device memory, with the vertices they reach.
+ *
+ * The edges are grouped by hop, and within a hop by the vertex they leave from. The vertices are the seeds followed
+ * by the vertices reached at every hop for the first time, each hop in increasing order, so they can index a compact
+ * feature matrix. The arrays are released with the subgraph.
+ *
+ * @tparam VertexT The type of the vertices.
+ * @tparam EdgeT The type of the edges.
+ */
+template<typename VertexT, typename EdgeT>
+class SampledSubgraph {
+public:
+  /**
+   * @brief Takes ownership of the sampled arrays, allocated in device memory through `memory::detail::memoryAlloc`.
+   */
+  SampledSubgraph(sycl::queue& q,
+                  VertexT* sources,
+                  VertexT* destinations,
+                  EdgeT* edges,
+                  VertexT* vertices,
+                  std::vector<size_t> layer_offsets,
+                  std::vector<size_t> hop_offsets)
+      : _queue(q), _sources(sources), _destinations(destinations), _edges(edges), _vertices(vertices), _layer_offsets(std::move(layer_offsets)),
+        _hop_offsets(std::move(hop_offsets)) {}
+
+  SampledSubgraph(const SampledSubgraph&) = delete;
+  SampledSubgraph& operator=(const SampledSubgraph&) = delete;
+
+  SampledSubgraph(SampledSubgraph&& other) noexcept
+      : _queue(other._queue), _sources(other._sources), _destinations(other._destinations), _edges(other._edges),
+        _vertices(other._vertices), _layer_offsets(std::move(other._layer_offsets)), _hop_offsets(std::move(other._hop_offsets)) {
+    other._sources = nullptr;
+    other._destinations = nullptr;
+    other._edges = nullptr;
+    other._vertices = nullptr;
+  }
+
+  ~SampledSubgraph() {
+    if (_sources != nullptr) { memory::detail::releaseUSM(_sources, _queue); }
+    if (_destinations != nullptr) { memory::detail::releaseUSM(_destinations, _queue); }
+    if (_edges != nullptr) { memory::detail::releaseUSM(_edges, _queue); }
+    if (_vertices != nullptr) { memory::detail::releaseUSM(_vertices, _queue); }
+  }
+
+  /**
+   * @brief Returns the source vertex of every sampled edge.
+   */
+  const VertexT* getSources() const { return _sources; }
+
+  /**
+   * @brief Returns the destination vertex of every sampled edge.
+   */
+  const VertexT* getDestinations() const { return _destinations; }
+
+  /**
+   * @brief Returns the index in the graph of every sampled edge, to look up its weight or features.
+   */
+  const EdgeT* getEdges() const { return _edges; }
+
+  /**
+   * @brief Returns the number of sampled edges.
+   */
+  size_t getEdgeCount() const { return _hop_offsets.back(); }
+
+  /**
+   * @brief Returns the seeds followed by the vertices reached by the sampling.
+   */
+  const VertexT* getVertices() const { return _vertices; }
+
+  /**
+   * @brief Returns the number of vertices in the subgraph.
+   */
+  size_t getVertexCount() const { return _layer_offsets.back(); }
+
+  /**
+   * @brief Returns where the edges of every hop start, followed by the edge count.
+   */
+  const std::vector<size_t>& getHopOffsets() const { return _hop_offsets; }
+
+  /**
+   * @brief Returns where the seeds and the vertices first reached at every hop start, followed by the vertex count.
+   */
+  const std::vector<size_t>& getLayerOffsets() const { return _layer_offsets; }
+
+private:
+  sycl::queue& _queue;
+  VertexT* _sources = nullptr;
+  VertexT* _destinations = nullptr;
+  EdgeT* _edges = nullptr;
+  VertexT* _vertices = nullptr;
+  std::vector<size_t> _layer_offsets;
+  std::vector<size_t> _hop_offsets;
+};
+
+/**
+ * @brief Samples the multi-hop out-neighborhood of a batch of seed vertices.
+ *
+ * At hop `h`, up to `fanouts[h]` out-neighbors of every vertex first reached at hop `h - 1` (the seeds for the first
+ * hop) are drawn without replacement, uniformly or by edge weight. Vertices with fewer neighbors keep all of them. The
+ * sample is a function of `seed` only, so a batch can be drawn again identically.
+ *
+ * @tparam Bias How the neighbors are drawn, `bias::uniform` by default.
+ * @tparam GraphT The type of the graph.
+ *
+ * @param graph The graph.
+ * @param seeds The distinct seed vertices, in device memory.
+ * @param num_seeds The number of seeds.
+ * @param fanouts The number of neighbors drawn per vertex at every hop.
+ * @param seed The seed of the random draws.
+ *
+ * @return The sampled subgraph, in device memory.
+ */
+template<bias Bias = bias::uniform, graph::detail::GraphConcept GraphT>
+auto neighbors(GraphT& graph, const typename GraphT::vertex_t* seeds, size_t num_seeds, const std::vector<size_t>& fanouts, uint64_t seed) {
+  using vertex_t = typename GraphT::vertex_t;
+  using edge_t = typename GraphT::edge_t;
+  sycl::queue& q = graph.getQueue();
+  const size_t num_vertices = graph.getVertexCount();
+  auto graph_dev = graph.getDeviceGraph();
+
+  vertex_t* vertices = memory::detail::memoryAlloc<vertex_t, memory::space::device>(num_seeds + num_vertices, q);
+  q.copy(seeds, vertices, num_seeds).wait();
+  std::vector<size_t> layer_offsets{0, num_seeds};
+  std::vector<size_t> hop_offsets{0};
+
+  uint32_t* visited = memory::detail::memoryAlloc<uint32_t, memory::space::device>(num_vertices, q);
+  uint32_t* discovered = memory::detail::memoryAlloc<uint32_t, memory::space::device>(num_vertices, q);
+  uint32_t* positions = memory::detail::memoryAlloc<uint32_t, memory::space::device>(num_vertices + 1, q);
+  size_t* offsets = memory::detail::memoryAlloc<size_t, memory::space::device>(num_vertices + num_seeds + 1, q);
+  auto e1 = q.fill(visited, 0U, num_vertices);
+  auto e2 = q.fill(discovered, 0U, num_vertices);
+  e1.wait();
+  e2.wait();
+  q.submit([&](sycl::handler& cgh) {
+     cgh.parallel_for<detail::sample_seeds_kernel>(sycl::range<1>{num_seeds}, [=](sycl::id<1> idx) { visited[seeds[idx[0]]] = 1; });
+   }).wait_and_throw();
+
+  // the edges of every hop are sampled into their own arrays, concatenated once their sizes are known
+  std::vector<vertex_t*> hop_sources;
+  std::vector<vertex_t*> hop_destinations;
+  std::vector<edge_t*> hop_edges;
+  for (size_t hop = 0; hop < fanouts.size(); hop++) {
+    const size_t layer_begin = layer_offsets[hop];
+    const size_t layer_size = layer_offsets[hop + 1] - layer_begin;
+    const vertex_t* layer = vertices + layer_begin;
+
+    const size_t hop_size = detail::launchCount(q, graph_dev, layer, layer_size, fanouts[hop], offsets);
+    hop_sources.push_back(memory::detail::memoryAlloc<vertex_t, memory::space::device>(hop_size, q));
+    hop_destinations.push_back(memory::detail::memoryAlloc<vertex_t, memory::space::device>(hop_size, q));
+    hop_edges.push_back(memory::detail::memoryAlloc<edge_t, memory::space::device>(hop_size, q));
+    if (layer_size > 0) {
+      auto e = detail::launchSelect<Bias>(q, graph_dev, layer, layer_size, offsets, fanouts[hop], seed, hop, visited, discovered,
+                                          hop_sources.back(), hop_destinations.back(), hop_edges.back());
+      e.waitAndThrow();
+    }
+    hop_offsets.push_back(hop_offsets.back() + hop_size);
+
+    const size_t reached = detail::launchCollect(q, num_vertices, visited, discovered, positions, vertices + layer_begin + layer_size);
+    layer_offsets.push_back(layer_offsets.back() + reached);
+  }
+
+  const size_t num_edges = hop_offsets.back();
+  vertex_t* sources = memory::detail::memoryAlloc<vertex_t, memory::space::device>(num_edges, q);
+  vertex_t* destinations = memory::detail::memoryAlloc<vertex_t, memory::space::device>(num_edges, q);
+  edge_t* edges = memory::detail::memoryAlloc<edge_t, memory::space::device>(num_edges, q);
+  for (size_t hop = 0; hop < fanouts.size(); hop++) {
+    const size_t begin = hop_offsets[hop];
+    const size_t size = hop_offsets[hop + 1] - begin;
+    auto c1 = q.copy(hop_sources[hop], sources + begin, size);
+    auto c2 = q.copy(hop_destinations[hop], destinations + begin, size);
+    auto c3 = q.copy(hop_edges[hop], edges + begin, size);
+    c1.wait();
+    c2.wait();
+    c3.wait();
+    memory::detail::releaseUSM(hop_sources[hop], q);
+    memory::detail::releaseUSM(hop_destinations[hop], q);
+    memory::detail::releaseUSM(hop_edges[hop], q);
+  }
+
+  memory::detail::releaseUSM(visited, q);
+  memory::detail::releaseUSM(discovered, q);
+  memory::detail::releaseUSM(positions, q);
+  memory::detail::releaseUSM(offsets, q);
+  return SampledSubgraph<vertex_t, edge_t>{q, sources, destinations, edges, vertices, std::move(layer_offsets), std::move(hop_offsets)};
+}
+
+} // namespace sample
+} // namespace operators
+} // namespace sygraph
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/build.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/spmv/semiring.hpp>
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/memory.hpp>
+#include <sygraph/utils/scan.hpp>
+#include <sygraph/utils/sort.hpp>
+
+namespace sygraph {
+namespace operators {
+namespace spgemm {
+namespace detail {
+
+template<typename SemiringT, typename MaskT>
+class spgemm_bound_kernel; // needed only for naming purposes
+template<typename SemiringT, typename MaskT, bool Numeric>
+class spgemm_accumulate_kernel; // needed only for naming purposes
+template<typename SemiringT>
+class spgemm_compact_kernel; // needed only for naming purposes
+
+// Every entry of the product is kept, a row has at most one entry per column.
+struct NoMask {
+  size_t n_cols;
+
+  SYCL_EXTERNAL inline size_t bound(size_t, size_t flops) const { return std::min(flops, n_cols); }
+  SYCL_EXTERNAL inline bool allows(size_t, size_t) const { return true; }
+};
+
+// Only the entries of the product that are edges of the mask graph are kept.
+template<typename GraphDevT>
+struct StructuralMask {
+  GraphDevT mask;
+
+  SYCL_EXTERNAL inline size_t bound(size_t row, size_t flops) const { return std::min(flops, mask.getDegree(row)); }
+
+  SYCL_EXTERNAL inline bool allows(size_t row, size_t col) const {
+    auto begin = mask.begin(row);
+    size_t low = 0;
+    size_t high = mask.getDegree(row);
+    while (low < high) {
+      const size_t mid = low + ((high - low) / 2);
+      if (static_cast<size_t>(*(begin + mid)) < col) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low < mask.getDegree(row) && static_cast<size_t>(*(begin + low)) == col;
+  }
+};
+
+SYCL_EXTERNAL inline size_t hashSlot(size_t col, size_t table_size) {
+  return (static_cast<uint32_t>(col) * 2654435761U) & (table_size - 1);
+}
+
+// Scatters the rows [begin, end) of A B into their tables, which start at slot `table_offsets[row] - base`. Every
+// column is counted by the work-item that claims its slot, and the symbolic pass only claims slots.
+template<typename SemiringT, bool Numeric, typename ADevT, typename BDevT, typename MaskT, typename IndexT, typename OffsetT>
+void launchAccumulate(sycl::queue& q,
+                      const ADevT& a_dev,
+                      const BDevT& b_dev,
+                      const MaskT& mask,
+                      const size_t* table_offsets,
+                      size_t base,
+                      size_t begin,
+                      size_t end,
+                      IndexT* keys,
+                      typename SemiringT::value_t* accumulators,
+                      OffsetT* row_counts) {
+  using value_t = typename SemiringT::value_t;
+  constexpr IndexT empty_slot = static_cast<IndexT>(-1);
+  if (begin == end) { return; }
+  const size_t local_size = sygraph::device::getProfile(q).compute_unit_size;
+  q.submit([&](sycl::handler& cgh) {
+     cgh.parallel_for<spgemm_accumulate_kernel<SemiringT, MaskT, Numeric>>(
+         sycl::nd_range<1>{(end - begin) * local_size, local_size}, [=](sycl::nd_item<1> item) {
+           const size_t row = begin + item.get_group_linear_id();
+           const size_t table_size = table_offsets[row + 1] - table_offsets[row];
+           if (table_size == 0) { return; }
+           IndexT* row_keys = keys + (table_offsets[row] - base);
+           value_t* row_accumulators = accumulators + (table_offsets[row] - base);
+           sycl::atomic_ref<OffsetT, sycl::memory_order::relaxed, sycl::memory_scope::device> count{row_counts[row]};
+
+           for (auto it = a_dev.begin(row); it != a_dev.end(row); ++it) {
+             const IndexT k = *it;
+             const value_t a_value = static_cast<value_t>(a_dev.getEdgeWeight(it.getIndex()));
+             const auto b_begin = b_dev.begin(k);
+             const size_t b_degree = b_dev.getDegree(k);
+             for (size_t i = item.get_local_linear_id(); i < b_degree; i += item.get_local_range(0)) {
+               const IndexT col = *(b_begin + i);
+               if (!mask.allows(row, col)) { continue; }
+               for (size_t slot = hashSlot(col, table_size);; slot = (slot + 1) & (table_size - 1)) {
+                 sycl::atomic_ref<IndexT, sycl::memory_order::relaxed, sycl::memory_scope::device> entry{row_keys[slot]};
+                 IndexT expected = empty_slot;
+                 if (entry.compare_exchange_strong(expected, col)) { count.fetch_add(OffsetT{1}); }
+                 if (expected == empty_slot || expected == col) {
+                   if constexpr (Numeric) {
+                     const value_t product = SemiringT::multiply(a_value, static_cast<value_t>(b_dev.getEdgeWeight((b_begin + i).getIndex())));
+                     sygraph::sync::atomicCombine(row_accumulators + slot, product, [](value_t x, value_t y) { return SemiringT::add(x, y); });
+                   }
+                   break;
+                 }
+               }
+             }
+           }
+         });
+   }).wait_and_throw();
+}
+
+// Moves the entries of the tables of the rows [begin, end) to their rows of C, sorted by column.
+template<typename SemiringT, typename IndexT, typename OffsetT>
+void launchCompact(sycl::queue& q,
+                   const size_t* table_offsets,
+                   size_t base,
+                   size_t begin,
+                   size_t end,
+                   const IndexT* keys,
+                   const typename SemiringT::value_t* accumulators,
+                   const OffsetT* row_offsets,
+                   IndexT* column_indices,
+                   typename SemiringT::value_t* values) {
+  constexpr IndexT empty_slot = static_cast<IndexT>(-1);
+  if (begin == end) { return; }
+  q.submit([&](sycl::handler& cgh) {
+     cgh.parallel_for<spgemm_compact_kernel<SemiringT>>(sycl::range<1>{end - begin}, [=](sycl::id<1> idx) {
+       const size_t row = begin + idx[0];
+       size_t cursor = row_offsets[row];
+       for (size_t slot = table_offsets[row] - base; slot < table_offsets[row + 1] - base; slot++) {
+         if (keys[slot] == empty_slot) { continue; }
+         column_indices[cursor] = keys[slot];
+         values[cursor] = accumulators[slot];
+         cursor++;
+       }
+       sygraph::sort::sortByKey(column_indices + row_offsets[row], values + row_offsets[row], cursor - row_offsets[row]);
+     });
+   }).wait_and_throw();
+}
+
+/**
+ * @brief Computes `C = A B` over a semiring, keeping only the entries of C allowed by the mask.
+ *
+ * Every row of C gets a hash table of twice its upper bound: the sum of the degrees in B of the columns of its row of
+ * A, capped by the number of columns, or by the degree of the row in the mask. A work-group per row walks its row of A
+ * and scatters the rows of B into the table, and the first work-item to claim a column counts it. A scan of the counts
+ * gives the row offsets of C, and every row is then compacted and sorted.
+ *
+ * The tables are built for batches of consecutive rows whose slots fit `slot_budget`, a quarter of the device memory
+ * when 0. When all rows fit a single batch, the counts come from the accumulation itself. Otherwise a symbolic pass
+ * over every batch counts the columns first, and every batch is then accumulated again and compacted straight into C.
+ */
+template<typename SemiringT, memory::space Space, typename IndexT, typename OffsetT, typename ValueT, typename MaskT>
+auto launchMultiply(graph::detail::GraphCSR<Space, IndexT, OffsetT, ValueT>& a,
+                    graph::detail::GraphCSR<Space, IndexT, OffsetT, ValueT>& b,
+                    const MaskT& mask,
+                    graph::Properties properties,
+                    size_t slot_budget = 0) {
+  using value_t = typename SemiringT::value_t;
+  constexpr IndexT empty_slot = static_cast<IndexT>(-1);
+  sycl::queue& q = a.getQueue();
+  const size_t n = a.getVertexCount();
+  if (b.getVertexCount() != n) { throw std::runtime_error("spgemm: the operands have different vertex counts"); }
+
+  auto a_dev = a.getDeviceGraph();
+  auto b_dev = b.getDeviceGraph();
+
+  // the tables of all rows are laid out back to back, at the offsets given by a scan of their sizes
+  size_t* table_offsets = memory::detail::memoryAlloc<size_t, memory::space::device>(n + 1, q);
+  q.submit([&](sycl::handler& cgh) {
+     cgh.parallel_for<spgemm_bound_kernel<SemiringT, MaskT>>(sycl::range<1>{n}, [=](sycl::id<1> idx) {
+       const size_t row = idx[0];
+       size_t flops = 0;
+       for (auto it = a_dev.begin(row); it != a_dev.end(row); ++it) { flops += b_dev.getDegree(*it); }
+       const size_t bound = mask.bound(row, flops);
+       table_offsets[row] = bound == 0 ? 0 : std::bit_ceil(2 * bound);
+     });
+   }).wait_and_throw();
+  sygraph::scan::exclusiveSum(q, table_offsets, table_offsets, n);
+  std::vector<size_t> host_offsets(n + 1);
+  q.copy(table_offsets, host_offsets.data(), n + 1).wait();
+
+  // a batch ends before the row that would take its tables past the budget, and holds at least one row
+  const size_t slot_bytes = sizeof(IndexT) + sizeof(value_t);
+  const size_t budget = slot_budget > 0 ? slot_budget : q.get_device().get_info<sycl::info::device::global_mem_size>() / (4 * slot_bytes);
+  std::vector<size_t> batches{0};
+  for (size_t row = 0; row < n; row++) {
+    if (row > batches.back() && host_offsets[row + 1] - host_offsets[batches.back()] > budget) { batches.push_back(row); }
+  }
+  batches.push_back(n);
+  size_t batch_slots = 1;
+  for (size_t i = 0; i + 1 < batches.size(); i++) {
+    batch_slots = std::max(batch_slots, host_offsets[batches[i + 1]] - host_offsets[batches[i]]);
+  }
+  const bool fused = batches.size() <= 2;
+
+  IndexT* keys = memory::detail::memoryAlloc<IndexT, memory::space::device>(batch_slots, q);
+  value_t* accumulators = memory::detail::memoryAlloc<value_t, memory::space::device>(batch_slots, q);
+  OffsetT* row_counts = memory::detail::memoryAlloc<OffsetT, memory::space::device>(n + 1, q);
+  q.fill(row_counts, OffsetT{0}, n + 1).wait();
+
+  auto clear_tables = [&](size_t slots) {
+    auto e1 = q.fill(keys, empty_slot, slots);
+    auto e2 = q.fill(accumulators, SemiringT::zero(), slots);
+    e1.wait();
+    e2.wait();
+  };
+
+  if (fused) {
+    clear_tables(host_offsets[n]);
+    launchAccumulate<SemiringT, true>(q, a_dev, b_dev, mask, table_offsets, 0, 0, n, keys, accumulators, row_counts);
+  } else {
+    for (size_t i = 0; i + 1 < batches.size(); i++) {
+      q.fill(keys, empty_slot, host_offsets[batches[i + 1]] - host_offsets[batches[i]]).wait();
+      launchAccumulate<SemiringT, false>(q, a_dev, b_dev, mask, table_offsets, host_offsets[batches[i]], batches[i], batches[i + 1], keys, accumulators, row_counts);
+    }
+  }
+
+  OffsetT* row_offsets = memory::detail::memoryAlloc<OffsetT, Space>(n + 1, q);
+  sygraph::scan::exclusiveSum(q, row_counts, row_offsets, n);
+  OffsetT nnz = 0;
+  q.copy(row_offsets + n, &nnz, 1).wait();
+
+  IndexT* column_indices = memory::detail::memoryAlloc<IndexT, Space>(nnz, q);
+  value_t* values = memory::detail::memoryAlloc<value_t, Space>(nnz, q);
+  for (size_t i = 0; i + 1 < batches.size(); i++) {
+    const size_t base = host_offsets[batches[i]];
+    if (!fused) {
+      clear_tables(host_offsets[batches[i + 1]] - base);
+      launchAccumulate<SemiringT, true>(q, a_dev, b_dev, mask, table_offsets, base, batches[i], batches[i + 1], keys, accumulators, row_counts);
+    }
+    launchCompact<SemiringT>(q, table_offsets, base, batches[i], batches[i + 1], keys, accumulators, row_offsets, column_indices, values);
+  }
+
+  memory::detail::releaseUSM(table_offsets, q);
+  memory::detail::releaseUSM(keys, q);
+  memory::detail::releaseUSM(accumulators, q);
+  memory::detail::releaseUSM(row_counts, q);
+
+  return graph::build::fromDeviceCSR<Space>(q, static_cast<IndexT>(n), row_offsets, column_indices, values, properties);
+}
+
+} // namespace detail
+} // namespace spgemm
+} // namespace operators
+} // namespace sygraph
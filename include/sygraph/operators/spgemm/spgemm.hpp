@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/spmv/semiring.hpp>
+
+#include <sygraph/operators/spgemm/impl_spgemm.hpp>
+
+namespace sygraph {
+namespace operators {
+
+/**
+ * @namespace spgemm
+ * Products of two graph adjacency matrices, returned as a new graph.
+ */
+namespace spgemm {
+
+/**
+ * @brief Computes the product `C = A B` of two adjacency matrices over a semiring.
+ *
+ * The edge `(u, v)` of C combines, over every path `u -> k -> v` with its first edge in A and its second in B, the
+ * product of the two edge weights. With A and B the same graph, C counts the 2-hop paths of every pair of vertices.
+ *
+ * @tparam SemiringT The semiring, `spmv::plus_times` by default.
+ *
+ * @param a The left operand.
+ * @param b The right operand, with the vertex count of `a`.
+ *
+ * @return The product, a weighted graph in the memory space of the operands, undirected when `a` and `b` are the same
+ * undirected graph and directed otherwise.
+ */
+template<typename SemiringT = void, memory::space Space, typename IndexT, typename OffsetT, typename ValueT>
+auto multiply(graph::detail::GraphCSR<Space, IndexT, OffsetT, ValueT>& a, graph::detail::GraphCSR<Space, IndexT, OffsetT, ValueT>& b) {
+  using semiring_t = std::conditional_t<std::is_void_v<SemiringT>, spmv::plus_times<ValueT>, SemiringT>;
+  // the square of a symmetric matrix is symmetric, and needs no inverse graph
+  const bool directed = &a != &b || a.getProperties().directed;
+  return detail::launchMultiply<semiring_t>(a, b, detail::NoMask{a.getVertexCount()}, graph::Properties{directed, true});
+}
+
+/**
+ * @brief Computes the masked product `C = (A B) ∘ M`, which keeps only the entries that are edges of the mask.
+ *
+ * The mask bounds the size of every row of C, so rows are sized by the mask instead of the full product. With A, B and
+ * M the same undirected graph, the entry of every edge is the number of triangles it belongs to.
+ *
+ * @tparam SemiringT The semiring, `spmv::plus_times` by default.
+ *
+ * @param a The left operand.
+ * @param b The right operand, with the vertex count of `a`.
+ * @param mask The graph whose edges are kept, with the vertex count of `a`. Its weights are ignored.
+ *
+ * @return The product, a weighted graph in the memory space of the operands, undirected when `a` and `b` are the same
+ * undirected graph and the mask is undirected.
+ */
+template<typename SemiringT = void, memory::space Space, typename IndexT, typename OffsetT, typename ValueT, graph::detail::GraphConcept MaskGraphT>
+auto multiply(graph::detail::GraphCSR<Space, IndexT, OffsetT, ValueT>& a,
+              graph::detail::GraphCSR<Space, IndexT, OffsetT, ValueT>& b,
+              MaskGraphT& mask) {
+  using semiring_t = std::conditional_t<std::is_void_v<SemiringT>, spmv::plus_times<ValueT>, SemiringT>;
+  if (mask.getVertexCount() != a.getVertexCount()) { throw std::runtime_error("spgemm: the mask has a different vertex count"); }
+  const bool directed = &a != &b || a.getProperties().directed || mask.getProperties().directed;
+  return detail::launchMultiply<semiring_t>(a, b, detail::StructuralMask<std::decay_t<decltype(mask.getDeviceGraph())>>{mask.getDeviceGraph()},
+                                            graph::Properties{directed, true});
+}
+
+} // namespace spgemm
+} // namespace operators
+} // namespace sygraph
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/device.hpp>
+
+namespace sygraph {
+namespace operators {
+namespace spmm {
+
+/**
+ * @brief How the scaled feature rows of the neighbors are combined.
+ */
+enum class aggregator {
+  sum,  ///< The sum of the rows.
+  mean, ///< The sum of the rows divided by the number of neighbors.
+  max,  ///< The largest value of every column, 0 for vertices without neighbors.
+};
+
+/**
+ * @brief Scaling of the adjacency matrix.
+ */
+enum class normalization {
+  none,      ///< The adjacency as it is.
+  symmetric, ///< Every entry `(u, v)` divided by `sqrt(degree(u) * degree(v))`, as in graph convolutions.
+};
+
+/**
+ * @brief Options of an aggregation.
+ */
+struct AggregationSettings {
+  bool edge_weights = false;                ///< Scales every neighbor row by the weight of its edge.
+  normalization norm = normalization::none; ///< Scaling of the adjacency matrix.
+  bool incoming = false;                    ///< Aggregates over the in-neighbors, read from the inverse graph.
+};
+
+namespace detail {
+
+template<aggregator Agg, typename T>
+class spmm_aggregate_kernel; // needed only for naming purposes
+
+template<aggregator Agg, graph::detail::DeviceGraphConcept GraphDevT, typename T>
+// Every work-group covers a block of rows and a tile of feature columns: the work-items of a row take consecutive
+// columns, so they read the same neighbor index, a broadcast, and consecutive values of the neighbor's feature row.
+struct AggregateKernel {
+  void operator()(sycl::nd_item<1> item) const {
+    const size_t lid = item.get_local_linear_id();
+    const size_t group = item.get_group_linear_id();
+    const size_t row = ((group / num_tiles) * rows_per_group) + (lid / tile_width);
+    const size_t column = ((group % num_tiles) * tile_width) + (lid % tile_width);
+    if (row >= graph_dev.getVertexCount() || column >= num_features) { return; }
+
+    const size_t degree = graph_dev.getDegree(row);
+    T acc = Agg == aggregator::max ? std::numeric_limits<T>::lowest() : T{};
+    for (auto it = graph_dev.begin(row); it != graph_dev.end(row); ++it) {
+      const auto neighbor = *it;
+      T value = features[(static_cast<size_t>(neighbor) * num_features) + column];
+      if (settings.edge_weights) { value *= static_cast<T>(graph_dev.getEdgeWeight(it.getIndex())); }
+      if (settings.norm == normalization::symmetric) {
+        value /= static_cast<T>(sycl::sqrt(static_cast<float>(degree) * static_cast<float>(graph_dev.getDegree(neighbor))));
+      }
+      if constexpr (Agg == aggregator::max) {
+        acc = value > acc ? value : acc;
+      } else {
+        acc += value;
+      }
+    }
+    if constexpr (Agg == aggregator::mean) {
+      if (degree > 0) { acc /= static_cast<T>(degree); }
+    } else if constexpr (Agg == aggregator::max) {
+      if (degree == 0) { acc = T{}; }
+    }
+    output[(row * num_features) + column] = acc;
+  }
+
+  const GraphDevT graph_dev;
+  const T* features;
+  T* output;
+  const size_t num_features;
+  const size_t tile_width;
+  const size_t rows_per_group;
+  const size_t num_tiles;
+  const AggregationSettings settings;
+};
+
+template<aggregator Agg, graph::detail::GraphConcept GraphT, typename T>
+sygraph::Event launchAggregate(GraphT& graph, const T* features, T* output, size_t num_features, const AggregationSettings& settings) {
+  sycl::queue& q = graph.getQueue();
+  const size_t num_vertices = graph.getVertexCount();
+  if (num_vertices == 0 || num_features == 0) { return {sycl::event{}}; }
+
+  const size_t local_size = sygraph::device::getProfile(q).compute_unit_size;
+  // narrow feature matrices pack several rows in a work-group instead of idling most of its work-items
+  const size_t tile_width = std::min(std::bit_ceil(num_features), local_size);
+  const size_t rows_per_group = local_size / tile_width;
+  const size_t num_tiles = (num_features + tile_width - 1) / tile_width;
+  const size_t num_groups = ((num_vertices + rows_per_group - 1) / rows_per_group) * num_tiles;
+  auto graph_dev = settings.incoming ? graph.getInverseDeviceGraph() : graph.getDeviceGraph();
+
+  using kernel_t = AggregateKernel<Agg, decltype(graph_dev), T>;
+  sygraph::Event e = q.submit([&](sycl::handler& cgh) {
+    cgh.parallel_for<spmm_aggregate_kernel<Agg, T>>(
+        sycl::nd_range<1>{num_groups * local_size, local_size},
+        kernel_t{graph_dev, features, output, num_features, tile_width, rows_per_group, num_tiles, settings});
+  });
+  return e;
+}
+
+} // namespace detail
+} // namespace spmm
+} // namespace operators
+} // namespace sygraph
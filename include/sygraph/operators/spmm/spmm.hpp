@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/sycl/event.hpp>
+
+#include <sygraph/operators/spmm/impl_spmm.hpp>
+
+namespace sygraph {
+namespace operators {
+
+/**
+ * @namespace spmm
+ * Products of the graph adjacency with dense row-major matrices of vertex features.
+ */
+namespace spmm {
+
+/**
+ * @brief Aggregates the feature rows of the neighbors of every vertex, the product of the adjacency with a dense matrix.
+ *
+ * Row `u` of `output` combines the rows of `features` of the out-neighbors of `u` (in-neighbors with
+ * `settings.incoming`), each scaled by the weight of its edge and by the normalization of the settings. Unlike an
+ * advance, every neighbor index is read once for a whole tile of feature columns.
+ *
+ * @tparam Agg The aggregator: `aggregator::sum`, `aggregator::mean` or `aggregator::max`.
+ * @tparam GraphT The type of the graph.
+ * @tparam T The type of the features.
+ *
+ * @param graph The graph.
+ * @param features The row-major input matrix in device memory, `vertex count x num_features`.
+ * @param output The row-major output matrix in device memory, `vertex count x num_features`, overwritten.
+ * @param num_features The number of columns of both matrices.
+ * @param settings Edge weight scaling, normalization and direction of the aggregation.
+ *
+ * @return An event representing the completion of the aggregation.
+ */
+template<aggregator Agg = aggregator::sum, graph::detail::GraphConcept GraphT, typename T>
+sygraph::Event aggregate(GraphT& graph, const T* features, T* output, size_t num_features, const AggregationSettings& settings = {}) {
+  return detail::launchAggregate<Agg>(graph, features, output, num_features, settings);
+}
+
+} // namespace spmm
+} // namespace operators
+} // namespace sygraph
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <type_traits>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/frontier/frontier.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/config.hpp>
+#include <sygraph/operators/for/for.hpp>
+#include <sygraph/operators/spmv/semiring.hpp>
+#include <sygraph/sycl/event.hpp>
+#include <sygraph/sync/atomics.hpp>
+#include <sygraph/utils/tuning.hpp>
+
+namespace sygraph {
+namespace operators {
+namespace spmv {
+namespace detail {
+
+template<typename SemiringT, bool Transposed, typename InputT, typename MaskT>
+class spmv_pull_kernel; // needed only for naming purposes
+template<typename SemiringT, bool Transposed, typename MaskT>
+class spmv_push_dense_kernel; // needed only for naming purposes
+template<typename SemiringT, typename MaskT>
+class spmv_clear_kernel; // needed only for naming purposes
+
+// Every entry of a dense input vector takes part in the product.
+struct DenseInput {
+  SYCL_EXTERNAL inline bool contains(size_t) const { return true; }
+};
+
+// Only the entries of a sparse input vector that belong to its frontier take part in the product.
+template<typename FrontierDevT>
+struct SparseInput {
+  FrontierDevT pattern;
+
+  SYCL_EXTERNAL inline bool contains(size_t index) const { return pattern.check(index); }
+};
+
+// Every entry of the output is written.
+struct NoMask {
+  SYCL_EXTERNAL inline bool allows(size_t) const { return true; }
+};
+
+// Only the entries of the output inside the mask, or outside it when complemented, are written.
+template<typename FrontierDevT>
+struct FrontierMask {
+  FrontierDevT mask;
+  bool complement;
+
+  SYCL_EXTERNAL inline bool allows(size_t index) const { return mask.check(index) != complement; }
+};
+
+// The product of an input entry with a matrix entry, in the operand order of the product.
+template<typename SemiringT, bool Transposed>
+SYCL_EXTERNAL inline typename SemiringT::value_t multiply(typename SemiringT::value_t x, typename SemiringT::value_t a) {
+  return Transposed ? SemiringT::multiply(a, x) : SemiringT::multiply(x, a);
+}
+
+/**
+ * @brief Computes `y = x A` (or `y = A x` when `Transposed`) over a semiring, pushing or pulling.
+ *
+ * The push scatters the contributions of every input entry along the rows of the matrix with atomic additions, and
+ * suits sparse inputs. The pull gathers, for every output entry, the contributions along the rows of the transposed
+ * matrix without atomics, and suits dense inputs. The rows of `A` are the CSR of the graph and the rows of its
+ * transpose the inverse graph, so a product with `A` swaps the two.
+ */
+template<typename SemiringT, bool Transposed, graph::detail::GraphConcept GraphT, typename InputT, typename PatternT, typename MaskT>
+sygraph::Event launchProduct(GraphT& graph,
+                             sygraph::operators::direction direction,
+                             const InputT& input,
+                             const PatternT* pattern, // the frontier of a sparse input, void for a dense one
+                             const typename SemiringT::value_t* x,
+                             typename SemiringT::value_t* y,
+                             const MaskT& mask) {
+  using value_t = typename SemiringT::value_t;
+  sycl::queue& q = graph.getQueue();
+  const size_t num_vertices = graph.getVertexCount();
+  if (num_vertices == 0) { return {sycl::event{}}; }
+
+  // the rows read by the push are those of x's side of the product, the pull reads the other side
+  auto push_graph = Transposed ? graph.getInverseDeviceGraph() : graph.getDeviceGraph();
+  auto pull_graph = Transposed ? graph.getDeviceGraph() : graph.getInverseDeviceGraph();
+
+  if (direction == sygraph::operators::direction::automatic) {
+    size_t active = num_vertices;
+    if constexpr (!std::is_same_v<PatternT, void>) { active = pattern->size(); }
+    const float density = static_cast<float>(active) / static_cast<float>(num_vertices);
+    direction = density >= sygraph::tuning::getProfile().spmv_pull_density ? sygraph::operators::direction::pull
+                                                                            : sygraph::operators::direction::push;
+  }
+
+  if (direction != sygraph::operators::direction::push) {
+    return q.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for<spmv_pull_kernel<SemiringT, Transposed, InputT, MaskT>>(sycl::range<1>{num_vertices}, [=](sycl::id<1> idx) {
+        const size_t row = idx[0];
+        if (!mask.allows(row)) { return; }
+        value_t acc = SemiringT::zero();
+        for (auto it = pull_graph.begin(row); it != pull_graph.end(row); ++it) {
+          const auto col = *it;
+          if (!input.contains(col)) { continue; }
+          acc = SemiringT::add(acc, multiply<SemiringT, Transposed>(x[col], static_cast<value_t>(pull_graph.getEdgeWeight(it.getIndex()))));
+        }
+        y[row] = acc;
+      });
+    });
+  }
+
+  auto clear_e = q.submit([&](sycl::handler& cgh) {
+    cgh.parallel_for<spmv_clear_kernel<SemiringT, MaskT>>(sycl::range<1>{num_vertices}, [=](sycl::id<1> idx) {
+      if (mask.allows(idx[0])) { y[idx[0]] = SemiringT::zero(); }
+    });
+  });
+  clear_e.wait_and_throw();
+
+  auto scatter = [=](size_t row) {
+    const value_t value = x[row];
+    for (auto it = push_graph.begin(row); it != push_graph.end(row); ++it) {
+      const auto col = *it;
+      if (!mask.allows(col)) { continue; }
+      const value_t product = multiply<SemiringT, Transposed>(value, static_cast<value_t>(push_graph.getEdgeWeight(it.getIndex())));
+      sygraph::sync::atomicCombine(y + col, product, [](value_t a, value_t b) { return SemiringT::add(a, b); });
+    }
+  };
+  if constexpr (!std::is_same_v<PatternT, void>) {
+    // only the active words of the frontier are visited
+    return sygraph::operators::compute::execute<sygraph::frontier::frontier_view::vertex>(graph, *pattern, scatter);
+  } else {
+    return q.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for<spmv_push_dense_kernel<SemiringT, Transposed, MaskT>>(sycl::range<1>{num_vertices}, [=](sycl::id<1> idx) { scatter(idx[0]); });
+    });
+  }
+}
+
+} // namespace detail
+} // namespace spmv
+} // namespace operators
+} // namespace sygraph
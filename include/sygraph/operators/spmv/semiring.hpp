@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <concepts>
+#include <limits>
+
+#include <sycl/sycl.hpp>
+
+namespace sygraph {
+namespace operators {
+namespace spmv {
+
+/**
+ * @brief A semiring over which the products of the graph matrix are computed.
+ *
+ * A semiring names its value type, the identity of its addition and the two operations. The addition must be
+ * associative and commutative, since the order in which contributions are combined depends on the schedule, and its
+ * identity must absorb the multiplication, so that missing entries contribute nothing.
+ */
+template<typename S>
+concept SemiringT = requires(typename S::value_t a, typename S::value_t b) {
+  { S::zero() } -> std::convertible_to<typename S::value_t>;
+  { S::add(a, b) } -> std::convertible_to<typename S::value_t>;
+  { S::multiply(a, b) } -> std::convertible_to<typename S::value_t>;
+};
+
+/**
+ * @brief The arithmetic semiring, for walks, PageRank-like propagation and neighbor sums.
+ */
+template<typename T>
+struct plus_times {
+  using value_t = T;
+  SYCL_EXTERNAL static T zero() { return T{}; }
+  SYCL_EXTERNAL static T add(T a, T b) { return a + b; }
+  SYCL_EXTERNAL static T multiply(T a, T b) { return a * b; }
+};
+
+/**
+ * @brief The tropical semiring, for shortest paths. The largest value stands for infinity and absorbs the addition.
+ */
+template<typename T>
+struct min_plus {
+  using value_t = T;
+  SYCL_EXTERNAL static T zero() { return std::numeric_limits<T>::max(); }
+  SYCL_EXTERNAL static T add(T a, T b) { return a < b ? a : b; }
+  SYCL_EXTERNAL static T multiply(T a, T b) { return (a == zero() || b == zero()) ? zero() : a + b; }
+};
+
+/**
+ * @brief The boolean semiring, for reachability. Any non-zero value is true.
+ */
+template<typename T>
+struct or_and {
+  using value_t = T;
+  SYCL_EXTERNAL static T zero() { return T{}; }
+  SYCL_EXTERNAL static T add(T a, T b) { return (a != T{} || b != T{}) ? T{1} : T{}; }
+  SYCL_EXTERNAL static T multiply(T a, T b) { return (a != T{} && b != T{}) ? T{1} : T{}; }
+};
+
+/**
+ * @brief The max-times semiring, for most reliable paths. Its zero is 0, so values and weights must not be negative.
+ */
+template<typename T>
+struct max_times {
+  using value_t = T;
+  SYCL_EXTERNAL static T zero() { return T{}; }
+  SYCL_EXTERNAL static T add(T a, T b) { return a < b ? b : a; }
+  SYCL_EXTERNAL static T multiply(T a, T b) { return a * b; }
+};
+
+} // namespace spmv
+} // namespace operators
+} // namespace sygraph
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/frontier/frontier.hpp>
+#include <sygraph/graph/graph.hpp>
+#include <sygraph/operators/config.hpp>
+#include <sygraph/sycl/event.hpp>
+
+#include <sygraph/operators/spmv/impl_spmv.hpp>
+#include <sygraph/operators/spmv/semiring.hpp>
+
+namespace sygraph {
+namespace operators {
+
+/**
+ * @namespace spmv
+ * Products of the graph, seen as a sparse matrix `A` with `A[u][v]` the weight of the edge from `u` to `v`, with vectors
+ * of one value per vertex, over user-defined semirings.
+ */
+namespace spmv {
+
+/**
+ * @brief Computes the vector-matrix product `y = x A` over a semiring: `y[v]` combines `x[u] * A[u][v]` over the
+ * in-neighbors `u` of `v`.
+ *
+ * The product pushes along the CSR of the graph or pulls along the inverse graph, as given by `Direction`; the
+ * automatic direction pulls when the input holds at least `spmv_pull_density` of the vertices (tuning profile).
+ *
+ * @tparam SemiringT The semiring, e.g. `plus_times<float>` or `min_plus<uint32_t>`. Pushes combine into `y` with
+ * atomics, so its value type must be supported by `sycl::atomic_ref`.
+ * @tparam Direction `direction::push`, `direction::pull` or `direction::automatic`.
+ *
+ * @param graph The graph.
+ * @param x The dense input vector, one value per vertex.
+ * @param y The output vector, one value per vertex, overwritten.
+ *
+ * @return An event representing the completion of the product.
+ */
+template<SemiringT Semiring, sygraph::operators::direction Direction = sygraph::operators::direction::automatic, graph::detail::GraphConcept GraphT>
+sygraph::Event vxm(GraphT& graph, const typename Semiring::value_t* x, typename Semiring::value_t* y) {
+  return detail::launchProduct<Semiring, false, GraphT, detail::DenseInput, void>(
+      graph, Direction, detail::DenseInput{}, nullptr, x, y, detail::NoMask{});
+}
+
+/**
+ * @brief Computes the masked vector-matrix product `y<mask> = x A` over a semiring.
+ *
+ * Only the entries of `y` whose vertex is in `mask`, or not in it when `complement` is set, are written; the others
+ * keep their value and cost no work in the pull direction.
+ */
+template<SemiringT Semiring,
+         sygraph::operators::direction Direction = sygraph::operators::direction::automatic,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename B>
+sygraph::Event vxm(GraphT& graph,
+                   const typename Semiring::value_t* x,
+                   typename Semiring::value_t* y,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& mask,
+                   bool complement = false) {
+  detail::FrontierMask<decltype(mask.getDeviceFrontier())> mask_dev{mask.getDeviceFrontier(), complement};
+  return detail::launchProduct<Semiring, false, GraphT, detail::DenseInput, void>(graph, Direction, detail::DenseInput{}, nullptr, x, y, mask_dev);
+}
+
+/**
+ * @brief Computes the vector-matrix product `y = x A` of a sparse input over a semiring.
+ *
+ * The input holds `x[u]` for the vertices `u` of `pattern` only, the other entries are the zero of the semiring and
+ * are never read. The automatic direction pushes from the frontier when it is sparse enough.
+ */
+template<SemiringT Semiring,
+         sygraph::operators::direction Direction = sygraph::operators::direction::automatic,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename B>
+sygraph::Event vxm(GraphT& graph,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& pattern,
+                   const typename Semiring::value_t* x,
+                   typename Semiring::value_t* y) {
+  detail::SparseInput<decltype(pattern.getDeviceFrontier())> input{pattern.getDeviceFrontier()};
+  return detail::launchProduct<Semiring, false>(graph, Direction, input, &pattern, x, y, detail::NoMask{});
+}
+
+/**
+ * @brief Computes the masked vector-matrix product `y<mask> = x A` of a sparse input over a semiring.
+ */
+template<SemiringT Semiring,
+         sygraph::operators::direction Direction = sygraph::operators::direction::automatic,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename B>
+sygraph::Event vxm(GraphT& graph,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& pattern,
+                   const typename Semiring::value_t* x,
+                   typename Semiring::value_t* y,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& mask,
+                   bool complement = false) {
+  detail::SparseInput<decltype(pattern.getDeviceFrontier())> input{pattern.getDeviceFrontier()};
+  detail::FrontierMask<decltype(mask.getDeviceFrontier())> mask_dev{mask.getDeviceFrontier(), complement};
+  return detail::launchProduct<Semiring, false>(graph, Direction, input, &pattern, x, y, mask_dev);
+}
+
+/**
+ * @brief Computes the matrix-vector product `y = A x` over a semiring: `y[u]` combines `A[u][v] * x[v]` over the
+ * out-neighbors `v` of `u`.
+ *
+ * It is the vector-matrix product of the transposed graph: the pull reads the CSR of the graph and the push the
+ * inverse graph. The parameters are those of `vxm`.
+ */
+template<SemiringT Semiring, sygraph::operators::direction Direction = sygraph::operators::direction::automatic, graph::detail::GraphConcept GraphT>
+sygraph::Event mxv(GraphT& graph, const typename Semiring::value_t* x, typename Semiring::value_t* y) {
+  return detail::launchProduct<Semiring, true, GraphT, detail::DenseInput, void>(
+      graph, Direction, detail::DenseInput{}, nullptr, x, y, detail::NoMask{});
+}
+
+/**
+ * @brief Computes the masked matrix-vector product `y<mask> = A x` over a semiring.
+ */
+template<SemiringT Semiring,
+         sygraph::operators::direction Direction = sygraph::operators::direction::automatic,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename B>
+sygraph::Event mxv(GraphT& graph,
+                   const typename Semiring::value_t* x,
+                   typename Semiring::value_t* y,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& mask,
+                   bool complement = false) {
+  detail::FrontierMask<decltype(mask.getDeviceFrontier())> mask_dev{mask.getDeviceFrontier(), complement};
+  return detail::launchProduct<Semiring, true, GraphT, detail::DenseInput, void>(graph, Direction, detail::DenseInput{}, nullptr, x, y, mask_dev);
+}
+
+/**
+ * @brief Computes the matrix-vector product `y = A x` of a sparse input over a semiring.
+ */
+template<SemiringT Semiring,
+         sygraph::operators::direction Direction = sygraph::operators::direction::automatic,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename B>
+sygraph::Event mxv(GraphT& graph,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& pattern,
+                   const typename Semiring::value_t* x,
+                   typename Semiring::value_t* y) {
+  detail::SparseInput<decltype(pattern.getDeviceFrontier())> input{pattern.getDeviceFrontier()};
+  return detail::launchProduct<Semiring, true>(graph, Direction, input, &pattern, x, y, detail::NoMask{});
+}
+
+/**
+ * @brief Computes the masked matrix-vector product `y<mask> = A x` of a sparse input over a semiring.
+ */
+template<SemiringT Semiring,
+         sygraph::operators::direction Direction = sygraph::operators::direction::automatic,
+         graph::detail::GraphConcept GraphT,
+         typename T,
+         typename B>
+sygraph::Event mxv(GraphT& graph,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& pattern,
+                   const typename Semiring::value_t* x,
+                   typename Semiring::value_t* y,
+                   const sygraph::frontier::Frontier<T, sygraph::frontier::frontier_type::mlb, B>& mask,
+                   bool complement = false) {
+  detail::SparseInput<decltype(pattern.getDeviceFrontier())> input{pattern.getDeviceFrontier()};
+  detail::FrontierMask<decltype(mask.getDeviceFrontier())> mask_dev{mask.getDeviceFrontier(), complement};
+  return detail::launchProduct<Semiring, true>(graph, Direction, input, &pattern, x, y, mask_dev);
+}
+
+} // namespace spmv
+} // namespace operators
+} // namespace sygraph
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <optional>
+
+#include <sycl/sycl.hpp>
+
+// recorded commands return events that cannot be profiled, so profiling builds always run eagerly
+#if defined(SYCL_EXT_ONEAPI_GRAPH) && !defined(ENABLE_PROFILING)
+#define SYGRAPH_COMMAND_GRAPH 1
+#endif
+
+namespace sygraph {
+
+/**
+ * @class IterationGraph
+ * @brief Submits the commands of an iteration body as a single SYCL command graph (`sycl_ext_oneapi_graph`).
+ *
+ * The first `run` records the commands that the body submits to the queue, and every `run` replays the recording with one
+ * submission. A body can be recorded only if it submits the same commands with the same arguments on every call, and never
+ * waits on the host. Without the extension, on out-of-order queues or on devices without graph support, `run` calls the
+ * body eagerly.
+ */
+class IterationGraph {
+public:
+  /**
+   * @brief Creates the executor of a queue. With `enabled` false the body always runs eagerly.
+   */
+  IterationGraph(sycl::queue& q, bool enabled = true) : _queue(q), _enabled(enabled && isSupported(q)) {}
+
+  /**
+   * @brief Returns true if iteration bodies can be recorded on the queue.
+   */
+  static bool isSupported(sycl::queue& q) {
+#ifdef SYGRAPH_COMMAND_GRAPH
+    return q.is_in_order() && q.get_device().has(sycl::aspect::ext_oneapi_limited_graph);
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @brief Returns true if `run` replays a recording instead of calling the body.
+   */
+  bool enabled() const { return _enabled; }
+
+  /**
+   * @brief Submits the commands of `body`, recording them on the first call when enabled.
+   */
+  template<typename BodyT>
+  void run(BodyT&& body) {
+#ifdef SYGRAPH_COMMAND_GRAPH
+    if (_enabled) {
+      namespace graph_ext = sycl::ext::oneapi::experimental;
+      if (!_executable) {
+        graph_ext::command_graph<graph_ext::graph_state::modifiable> graph{_queue.get_context(), _queue.get_device()};
+        graph.begin_recording(_queue);
+        body();
+        graph.end_recording(_queue);
+        _executable.emplace(graph.finalize());
+      }
+      _queue.ext_oneapi_graph(*_executable);
+      return;
+    }
+#endif
+    body();
+  }
+
+private:
+  sycl::queue& _queue;
+  bool _enabled;
+#ifdef SYGRAPH_COMMAND_GRAPH
+  std::optional<sycl::ext::oneapi::experimental::command_graph<sycl::ext::oneapi::experimental::graph_state::executable>> _executable;
+#endif
+};
+
+} // namespace sygraph
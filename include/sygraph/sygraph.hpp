@@ -9,6 +9,7 @@
 #include <sygraph/formats/csr.hpp>
 
 // Include Frontier
+#include <sygraph/frontier/convergence.hpp>
 #include <sygraph/frontier/frontier.hpp>
 #include <sygraph/frontier/frontier_settings.hpp>
 
@@ -22,8 +23,13 @@
 #include <sygraph/io/read_csr.hpp>
 
 // Include utils
+#include <sygraph/sycl/command_graph.hpp>
 #include <sygraph/sycl/event.hpp>
 #include <sygraph/utils/memory.hpp>
+#include <sygraph/utils/random.hpp>
+#include <sygraph/utils/scan.hpp>
+#include <sygraph/utils/sort.hpp>
+#include <sygraph/utils/tuning.hpp>
 
 // Include operators
 #include <sygraph/operators/advance/advance.hpp>
@@ -31,11 +37,22 @@
 #include <sygraph/operators/filter/filter.hpp>
 #include <sygraph/operators/for/for.hpp>
 #include <sygraph/operators/intersection/intersection.hpp>
+#include <sygraph/operators/sample/sample.hpp>
+#include <sygraph/operators/spgemm/spgemm.hpp>
+#include <sygraph/operators/spmm/spmm.hpp>
+#include <sygraph/operators/spmv/spmv.hpp>
 
 // Include algorithms
 #include <sygraph/algorithms/bc.hpp>
 #include <sygraph/algorithms/bfs.hpp>
 #include <sygraph/algorithms/cc.hpp>
+#include <sygraph/algorithms/coloring.hpp>
+#include <sygraph/algorithms/kcore.hpp>
+#include <sygraph/algorithms/label_propagation.hpp>
+#include <sygraph/algorithms/louvain.hpp>
+#include <sygraph/algorithms/matching.hpp>
+#include <sygraph/algorithms/mis.hpp>
+#include <sygraph/algorithms/random_walk.hpp>
 #include <sygraph/algorithms/sssp.hpp>
 #include <sygraph/algorithms/tc.hpp>
 
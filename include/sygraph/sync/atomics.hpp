@@ -27,6 +27,21 @@ SYCL_EXTERNAL inline T atomicFetchAdd(T* ptr, T val) {
   return ref.fetch_add(val);
 }
 
+/**
+ * @brief Performs an atomic fetch-and-subtract operation on the given pointer, with relaxed memory order and device
+ * memory scope.
+ *
+ * @tparam T The type of the value to be subtracted.
+ * @param ptr A pointer to the value to be modified.
+ * @param val The value to be subtracted from the value pointed to by ptr.
+ * @return The value of the pointed-to object immediately before the subtraction.
+ */
+template<typename T>
+SYCL_EXTERNAL inline T atomicFetchSub(T* ptr, T val) {
+  sycl::atomic_ref<T, sycl::memory_order::relaxed, sycl::memory_scope::device> ref(*ptr);
+  return ref.fetch_sub(val);
+}
+
 /**
  * @brief Loads a value from the given pointer using SYCL atomic operations.
  *
@@ -98,5 +113,26 @@ SYCL_EXTERNAL inline bool cas(T* ptr, T& expected, T desired) {
   sycl::atomic_ref<T, sycl::memory_order::relaxed, sycl::memory_scope::device> ref(*ptr);
   return ref.compare_exchange_strong(expected, desired);
 }
+
+/**
+ * @brief Combines a value into the given pointer with an arbitrary associative operator.
+ *
+ * The combination is retried with compare-and-swap until no other work-item changed the value in between, so it works
+ * for operators without a native atomic, such as the additions of user-defined semirings.
+ *
+ * @tparam T The type of the value, which must be supported by `sycl::atomic_ref`.
+ * @tparam OpT The type of the operator, callable as `op(T, T) -> T`.
+ * @param ptr A pointer to the value to be modified.
+ * @param val The value to be combined with the value pointed to by ptr.
+ * @param op The operator combining the two values.
+ * @return The value of the pointed-to object immediately before the combination.
+ */
+template<typename T, typename OpT>
+SYCL_EXTERNAL inline T atomicCombine(T* ptr, T val, OpT op) {
+  sycl::atomic_ref<T, sycl::memory_order::relaxed, sycl::memory_scope::device> ref(*ptr);
+  T expected = ref.load();
+  while (!ref.compare_exchange_weak(expected, op(expected, val))) {}
+  return expected;
+}
 } // namespace sync
 } // namespace sygraph
\ No newline at end of file
@@ -6,33 +6,164 @@
 
 #include <sycl/sycl.hpp>
 #include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/tuning.hpp>
+#include <sygraph/utils/types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace sygraph {
-namespace detail {
 namespace device {
 
-uint32_t getMaxNumSubgroups(sycl::queue& queue) {
-  auto device = queue.get_device();
-  return device.get_info<sycl::info::device::max_num_sub_groups>();
+/**
+ * @brief Device properties used to configure kernel launches.
+ *
+ * A profile is queried once per device and cached. Values can be overridden with `setProfile` to tune launches
+ * without touching the library code.
+ */
+struct DeviceProfile {
+  uint32_t num_compute_units = 0;        ///< Number of compute units (SMs, Xe-cores, CUs).
+  uint32_t max_num_sub_groups = 0;       ///< Maximum number of sub-groups in a work-group.
+  std::vector<uint32_t> sub_group_sizes; ///< Sub-group sizes supported by the device.
+  uint32_t sub_group_size = 0;           ///< Sub-group size assumed by the kernels.
+  size_t local_mem_size = 0;             ///< Local memory available to a work-group, in bytes.
+  size_t max_work_group_size = 0;        ///< Maximum number of work-items in a work-group.
+  size_t bitmap_width = 0;               ///< Preferred bitmap word width in bits, matching the sub-group size.
+  size_t compute_unit_size = 0;          ///< Work-group width of the frontier-wide kernels.
+};
+
+/**
+ * @brief Queries the SYCL runtime for the properties of a device, bypassing the cache.
+ */
+inline DeviceProfile queryProfile(const sycl::device& device) {
+  DeviceProfile profile;
+  profile.num_compute_units = static_cast<uint32_t>(device.get_info<sycl::ext::oneapi::info::device::num_compute_units>());
+  profile.max_num_sub_groups = device.get_info<sycl::info::device::max_num_sub_groups>();
+  for (auto size : device.get_info<sycl::info::device::sub_group_sizes>()) { profile.sub_group_sizes.push_back(static_cast<uint32_t>(size)); }
+  profile.sub_group_size = profile.sub_group_sizes.empty() ? 1 : profile.sub_group_sizes[0];
+  profile.local_mem_size = device.get_info<sycl::info::device::local_mem_size>();
+  profile.max_work_group_size = device.get_info<sycl::info::device::max_work_group_size>();
+
+  uint32_t widest_sub_group = profile.sub_group_sizes.empty() ? 0 : *std::max_element(profile.sub_group_sizes.begin(), profile.sub_group_sizes.end());
+  profile.bitmap_width = widest_sub_group >= 64 ? 64 : 32;
+  profile.compute_unit_size = std::min(types::detail::COMPUTE_UNIT_SIZE, profile.max_work_group_size);
+  return profile;
+}
+
+namespace detail {
+
+/**
+ * @brief Profiles installed for every device. Installed profiles are never modified nor freed, so references to them
+ * stay valid after they are replaced or reset.
+ */
+struct ProfileRegistry {
+  std::mutex mutex;
+  std::unordered_map<sycl::device, const DeviceProfile*> current;
+  std::vector<std::unique_ptr<const DeviceProfile>> installed;
+  std::atomic<uint64_t> generation{0}; ///< Bumped on every change, invalidates the per-thread caches.
+
+  const DeviceProfile* install(const sycl::device& device, const DeviceProfile& profile) {
+    installed.push_back(std::make_unique<const DeviceProfile>(profile));
+    current[device] = installed.back().get();
+    generation.fetch_add(1, std::memory_order_release);
+    return installed.back().get();
+  }
+};
+
+inline ProfileRegistry& profileRegistry() {
+  // Intentionally leaked, like the profiles it holds.
+  static auto* registry = new ProfileRegistry();
+  return *registry;
 }
 
-uint32_t getSubgroupSize(sycl::queue& queue) {
+} // namespace detail
+
+/**
+ * @brief Returns the cached profile of the queue's device, querying the runtime on first use only.
+ *
+ * The work-group size and bitmap width of the active tuning profile, when set, replace the queried ones, unless the
+ * profile was tuned on a device with another name, which is reported on the standard error. Lookups are
+ * served by a per-thread cache and only take the registry lock when the cache misses. The returned profile is never
+ * modified: later calls to `setProfile` or `resetProfile` install a new one and the reference stays valid.
+ */
+inline const DeviceProfile& getProfile(const sycl::queue& queue) {
+  auto& registry = detail::profileRegistry();
+  thread_local std::unordered_map<sycl::device, const DeviceProfile*> cache;
+  thread_local uint64_t cache_generation = 0;
+
+  const uint64_t generation = registry.generation.load(std::memory_order_acquire);
+  if (cache_generation != generation) {
+    cache.clear();
+    cache_generation = generation;
+  }
   auto device = queue.get_device();
-  return device.get_info<sycl::info::device::sub_group_sizes>()[0];
+  auto cached = cache.find(device);
+  if (cached != cache.end()) { return *cached->second; }
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.current.find(device);
+  const DeviceProfile* profile = it != registry.current.end() ? it->second : nullptr;
+  if (profile == nullptr) {
+    DeviceProfile queried = queryProfile(device);
+    const auto& tuning = sygraph::tuning::getProfile();
+    const std::string name = device.get_info<sycl::info::device::name>();
+    if (!tuning.device.empty() && tuning.device != name) {
+      // the launch shapes of another device may not suit this one, the algorithm policies are still applied
+      std::cerr << "SYgraph: the tuning profile was tuned on '" << tuning.device << "', its work-group size and bitmap width are ignored on '"
+                << name << "'" << std::endl;
+    } else {
+      if (tuning.compute_unit_size > 0) { queried.compute_unit_size = std::min(tuning.compute_unit_size, queried.max_work_group_size); }
+      if (tuning.bitmap_width > 0) { queried.bitmap_width = tuning.bitmap_width; }
+    }
+    profile = registry.install(device, queried);
+  }
+  // the generation read above may be stale, the entry is then dropped on the next call
+  cache.emplace(device, profile);
+  return *profile;
 }
 
-uint32_t getWorkgroupSize(sycl::queue& queue) {
+/**
+ * @brief Overrides the cached profile of the queue's device. Every launch issued afterwards uses the new values.
+ */
+inline void setProfile(const sycl::queue& queue, const DeviceProfile& profile) {
   auto device = queue.get_device();
-  return device.get_info<sycl::info::device::max_work_group_size>();
+  auto& registry = detail::profileRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.install(device, profile);
 }
 
-uint32_t getNumComputeUnits(sycl::queue& queue) {
+/**
+ * @brief Drops the cached profile of the queue's device, so that it is queried again on next use.
+ */
+inline void resetProfile(const sycl::queue& queue) {
   auto device = queue.get_device();
-  return device.get_info<sycl::ext::oneapi::info::device::num_compute_units>();
+  auto& registry = detail::profileRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.current.erase(device);
+  registry.generation.fetch_add(1, std::memory_order_release);
 }
 
+} // namespace device
+
+namespace detail {
+namespace device {
+
+inline uint32_t getMaxNumSubgroups(sycl::queue& queue) { return sygraph::device::getProfile(queue).max_num_sub_groups; }
+
+inline uint32_t getSubgroupSize(sycl::queue& queue) { return sygraph::device::getProfile(queue).sub_group_size; }
+
+inline uint32_t getWorkgroupSize(sycl::queue& queue) { return static_cast<uint32_t>(sygraph::device::getProfile(queue).max_work_group_size); }
+
+inline uint32_t getNumComputeUnits(sycl::queue& queue) { return sygraph::device::getProfile(queue).num_compute_units; }
+
+inline size_t getLocalMemSize(sycl::queue& queue) { return sygraph::device::getProfile(queue).local_mem_size; }
+
 } // namespace device
 } // namespace detail
-} // namespace sygraph
\ No newline at end of file
+} // namespace sygraph
@@ -6,28 +6,295 @@
 
 #include <sycl/sycl.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
 namespace sygraph {
 namespace memory {
 
 enum class space { host, device, shared };
 
+/**
+ * @brief Tuning knobs of the per-queue caching pool.
+ *
+ * Requests up to `max_bin_bytes` are rounded up to the next power of two (never below `min_bin_bytes`), so that blocks of
+ * similar size can be recycled. Larger requests are cached with their exact (page rounded) size. Blocks released while
+ * more than `max_cached_bytes` are already cached are returned to the runtime immediately.
+ */
+struct PoolSettings {
+  bool enabled = true;
+  size_t min_bin_bytes = size_t{1} << 8;
+  size_t max_bin_bytes = size_t{1} << 26;
+  size_t max_cached_bytes = std::numeric_limits<size_t>::max();
+};
+
+/**
+ * @brief Counters describing the state of a pool.
+ */
+struct PoolStats {
+  size_t live_bytes = 0;   ///< Bytes currently handed out to the library.
+  size_t cached_bytes = 0; ///< Bytes held by the pool and ready for reuse.
+  size_t hits = 0;         ///< Allocations served from the cache.
+  size_t misses = 0;       ///< Allocations that required a runtime allocation.
+};
+
+namespace detail {
+
+/**
+ * @brief Caching allocator for USM memory bound to a single queue.
+ *
+ * Released blocks are kept in size-class bins, one set per memory space, and handed back to later requests of the same
+ * class. Reuse is stream-ordered: a block released together with an event is only recycled once the event completes.
+ * Blocks that are not cached are kept in a deferred list until their event completes, so that no call waits for device
+ * work while holding the pool lock.
+ */
+class MemoryPool {
+public:
+  explicit MemoryPool(sycl::queue& q) : _queue(q) {}
+
+  MemoryPool(const MemoryPool&) = delete;
+  MemoryPool& operator=(const MemoryPool&) = delete;
+
+  ~MemoryPool() { trim(); }
+
+  void* allocate(size_t bytes, space s) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    freeCompleted();
+    size_t class_bytes = sizeClass(bytes);
+
+    if (_settings.enabled) {
+      auto& bin = _bins[static_cast<size_t>(s)];
+      auto range = bin.equal_range(class_bytes);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (!isReusable(it->second)) { continue; }
+        void* ptr = it->second.ptr;
+        bin.erase(it);
+        _stats.cached_bytes -= class_bytes;
+        _stats.live_bytes += class_bytes;
+        _stats.hits++;
+        _live[ptr] = {class_bytes, s};
+        return ptr;
+      }
+    }
+
+    void* ptr = runtimeAlloc(class_bytes, s);
+    if (ptr == nullptr) {
+      // the runtime may be out of memory because of cached blocks, give them back and retry once
+      auto blocks = takeCached();
+      lock.unlock();
+      freeBlocks(blocks);
+      lock.lock();
+      ptr = runtimeAlloc(class_bytes, s);
+      if (ptr == nullptr) { throw std::runtime_error("USM allocation failed"); }
+    }
+    _stats.live_bytes += class_bytes;
+    _stats.misses++;
+    _live[ptr] = {class_bytes, s};
+    return ptr;
+  }
+
+  /**
+   * @brief Returns a block to the pool.
+   *
+   * @param ptr The block obtained through `allocate`. Pointers unknown to the pool are freed once `ready` completes.
+   * @param ready Event after which the block is no longer used by the device.
+   */
+  void release(void* ptr, sycl::event ready = {}) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    freeCompleted();
+    auto it = _live.find(ptr);
+    if (it == _live.end()) {
+      _deferred.push_back({ptr, ready});
+      return;
+    }
+
+    auto [class_bytes, s] = it->second;
+    _live.erase(it);
+    _stats.live_bytes -= class_bytes;
+
+    if (!_settings.enabled || _stats.cached_bytes + class_bytes > _settings.max_cached_bytes) {
+      _deferred.push_back({ptr, ready});
+      return;
+    }
+    _bins[static_cast<size_t>(s)].emplace(class_bytes, CachedBlock{ptr, ready});
+    _stats.cached_bytes += class_bytes;
+  }
+
+  /**
+   * @brief Frees every cached block, waiting for their events. Blocks still in use are not affected.
+   */
+  void trim() {
+    std::vector<CachedBlock> blocks;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      blocks = takeCached();
+    }
+    freeBlocks(blocks);
+  }
+
+  void setSettings(const PoolSettings& settings) {
+    std::vector<CachedBlock> blocks;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _settings = settings;
+      if (!_settings.enabled) { blocks = takeCached(); }
+    }
+    freeBlocks(blocks);
+  }
+
+  PoolSettings getSettings() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _settings;
+  }
+
+  PoolStats getStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+  }
+
+private:
+  struct CachedBlock {
+    void* ptr;
+    sycl::event ready;
+  };
+
+  struct LiveBlock {
+    size_t bytes;
+    space s;
+  };
+
+  size_t sizeClass(size_t bytes) const {
+    if (bytes > _settings.max_bin_bytes) {
+      constexpr size_t page = size_t{1} << 12;
+      return (bytes + page - 1) / page * page;
+    }
+    size_t class_bytes = _settings.min_bin_bytes;
+    while (class_bytes < bytes) { class_bytes <<= 1; }
+    return class_bytes;
+  }
+
+  bool isReusable(const CachedBlock& block) const {
+    return block.ready.get_info<sycl::info::event::command_execution_status>() == sycl::info::event_command_status::complete;
+  }
+
+  void* runtimeAlloc(size_t bytes, space s) {
+    if (s == space::host) { return sycl::malloc_host(bytes, _queue); }
+    if (s == space::device) { return sycl::malloc_device(bytes, _queue); }
+    return sycl::malloc_shared(bytes, _queue);
+  }
+
+  // frees the deferred blocks whose event completed, without waiting for the others
+  void freeCompleted() {
+    auto completed = std::partition(_deferred.begin(), _deferred.end(), [this](const CachedBlock& block) { return !isReusable(block); });
+    for (auto it = completed; it != _deferred.end(); ++it) { sycl::free(it->ptr, _queue); }
+    _deferred.erase(completed, _deferred.end());
+  }
+
+  // empties the bins and the deferred list, the blocks are freed by `freeBlocks` once the lock is released
+  std::vector<CachedBlock> takeCached() {
+    std::vector<CachedBlock> blocks = std::move(_deferred);
+    _deferred.clear();
+    for (auto& bin : _bins) {
+      for (auto& [class_bytes, block] : bin) { blocks.push_back(block); }
+      bin.clear();
+    }
+    _stats.cached_bytes = 0;
+    return blocks;
+  }
+
+  void freeBlocks(std::vector<CachedBlock>& blocks) {
+    for (auto& block : blocks) {
+      block.ready.wait();
+      sycl::free(block.ptr, _queue);
+    }
+    blocks.clear();
+  }
+
+  sycl::queue _queue;
+  mutable std::mutex _mutex;
+  PoolSettings _settings;
+  PoolStats _stats;
+  std::multimap<size_t, CachedBlock> _bins[3];
+  std::unordered_map<void*, LiveBlock> _live;
+  std::vector<CachedBlock> _deferred;
+};
+
+inline std::mutex& poolRegistryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+inline std::unordered_map<sycl::queue, std::unique_ptr<MemoryPool>>& poolRegistry() {
+  // Intentionally leaked: cached blocks must outlive static destructors that may still release memory at exit.
+  // Pools that are no longer needed are dropped with `erasePool`.
+  static auto* registry = new std::unordered_map<sycl::queue, std::unique_ptr<MemoryPool>>();
+  return *registry;
+}
+
+} // namespace detail
+
+/**
+ * @brief Returns the caching pool associated with the given queue, creating it on first use.
+ *
+ * Copies of the same queue share the same pool.
+ */
+inline detail::MemoryPool& getPool(sycl::queue& q) {
+  std::lock_guard<std::mutex> lock(detail::poolRegistryMutex());
+  auto& registry = detail::poolRegistry();
+  auto it = registry.find(q);
+  if (it == registry.end()) { it = registry.emplace(q, std::make_unique<detail::MemoryPool>(q)).first; }
+  return *it->second;
+}
+
+/**
+ * @brief Returns every cached block of the queue's pool to the SYCL runtime.
+ */
+inline void trim(sycl::queue& q) { getPool(q).trim(); }
+
+/**
+ * @brief Returns every cached block of every pool to the SYCL runtime.
+ */
+inline void trimAll() {
+  std::lock_guard<std::mutex> lock(detail::poolRegistryMutex());
+  for (auto& [q, pool] : detail::poolRegistry()) { pool->trim(); }
+}
+
+/**
+ * @brief Destroys the pool of the queue, returning its cached blocks to the SYCL runtime.
+ *
+ * The registry keeps the queue, and with it its context, alive until its pool is erased. Blocks still handed out are
+ * unknown to any later pool of the queue and are freed once released and their event completes.
+ */
+inline void erasePool(sycl::queue& q) {
+  std::unique_ptr<detail::MemoryPool> pool;
+  {
+    std::lock_guard<std::mutex> lock(detail::poolRegistryMutex());
+    auto& registry = detail::poolRegistry();
+    auto it = registry.find(q);
+    if (it == registry.end()) { return; }
+    pool = std::move(it->second);
+    registry.erase(it);
+  }
+}
+
 namespace detail {
 
 template<typename T, space V>
 inline T* memoryAlloc(size_t n, sycl::queue& q) {
-  if constexpr (V == space::host) {
-    return sycl::malloc_host<T>(n, q);
-  } else if constexpr (V == space::device) {
-    return sycl::malloc_device<T>(n, q);
-  } else if constexpr (V == space::shared) {
-    T* ptr = sycl::malloc_shared<T>(n, q);
+  static_assert(V == space::host || V == space::device || V == space::shared, "Unknown memory space");
+
+  T* ptr = static_cast<T*>(getPool(q).allocate(std::max<size_t>(n, 1) * sizeof(T), V));
 #ifdef ENABLE_PREFETCH
-    q.prefetch(ptr, n * sizeof(T)).wait();
+  if constexpr (V == space::shared) { q.prefetch(ptr, n * sizeof(T)).wait(); }
 #endif
-    return ptr;
-  }
-
-  throw std::runtime_error("Unknown memory space");
+  return ptr;
 }
 
 template<typename T>
@@ -39,11 +306,25 @@ inline T* memoryAlloc(size_t n, sycl::queue& q, sygraph::memory::space s) {
   throw std::runtime_error("Unknown memory space");
 }
 
+/**
+ * @brief Returns the memory to the queue's pool. The caller guarantees that no pending command uses it.
+ */
 template<typename T>
 inline void releaseUSM(T*& ptr, sycl::queue& q) {
   if (ptr == nullptr) { return; }
 
-  sycl::free(ptr, q);
+  getPool(q).release(static_cast<void*>(ptr));
+  ptr = nullptr;
+}
+
+/**
+ * @brief Returns the memory to the queue's pool once `ready` completes, without blocking the host.
+ */
+template<typename T>
+inline void releaseUSM(T*& ptr, sycl::queue& q, sycl::event ready) {
+  if (ptr == nullptr) { return; }
+
+  getPool(q).release(static_cast<void*>(ptr), ready);
   ptr = nullptr;
 }
 
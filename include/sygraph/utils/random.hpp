@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+#include <sycl/sycl.hpp>
+
+namespace sygraph {
+
+/**
+ * @namespace random
+ * Deterministic random numbers for device code.
+ *
+ * The numbers are a hash of a seed, a stream and a counter rather than the state of a shared generator, so a kernel
+ * draws the same values whatever the order in which its work-items run, and a run can be reproduced from its seed.
+ */
+namespace random {
+
+/**
+ * @brief The SplitMix64 finalizer, a bijective mix of the bits of a 64-bit value.
+ */
+SYCL_EXTERNAL inline uint64_t mix(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief Returns 64 random bits for a counter of a stream.
+ * @param seed The seed of the run.
+ * @param stream The stream, e.g. the step of an algorithm, so that streams of the same seed are independent.
+ * @param counter The position in the stream, e.g. the index of an edge or of a work-item.
+ */
+SYCL_EXTERNAL inline uint64_t bits(uint64_t seed, uint64_t stream, uint64_t counter) {
+  return mix(mix(mix(seed) ^ stream) ^ counter);
+}
+
+/**
+ * @brief Returns a float uniformly distributed in (0, 1] for a counter of a stream.
+ */
+SYCL_EXTERNAL inline float uniform(uint64_t seed, uint64_t stream, uint64_t counter) {
+  // the top 24 bits fill the mantissa exactly, and the offset keeps 0 out of the range so that its logarithm is finite
+  return static_cast<float>((bits(seed, stream, counter) >> 40) + 1) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief A sequential generator for a work-item that draws several numbers, seeded from a stream and counter.
+ */
+struct Generator {
+  uint64_t state;
+
+  SYCL_EXTERNAL Generator(uint64_t seed, uint64_t stream, uint64_t counter) : state(bits(seed, stream, counter)) {}
+
+  /**
+   * @brief Returns the next 64 random bits.
+   */
+  SYCL_EXTERNAL inline uint64_t next() {
+    state += 0x9E3779B97F4A7C15ULL;
+    return mix(state);
+  }
+
+  /**
+   * @brief Returns the next float uniformly distributed in (0, 1].
+   */
+  SYCL_EXTERNAL inline float nextUniform() { return static_cast<float>((next() >> 40) + 1) * (1.0f / 16777216.0f); }
+
+  /**
+   * @brief Returns the next integer uniformly distributed in [0, bound), for a positive bound.
+   */
+  SYCL_EXTERNAL inline uint64_t nextBelow(uint64_t bound) {
+    // the high half of the product of a 32-bit draw and the bound, unbiased enough for bounds far below 2^32
+    return ((next() >> 32) * bound) >> 32;
+  }
+};
+
+} // namespace random
+} // namespace sygraph
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <sycl/sycl.hpp>
+
+#include <sygraph/sycl/event.hpp>
+#include <sygraph/utils/device.hpp>
+#include <sygraph/utils/memory.hpp>
+
+namespace sygraph {
+namespace scan {
+namespace detail {
+
+template<typename InT, typename OutT>
+class scan_blocks_kernel; // needed only for naming purposes
+template<typename OutT>
+class scan_totals_kernel; // needed only for naming purposes
+template<typename OutT>
+class scan_add_kernel; // needed only for naming purposes
+
+} // namespace detail
+
+/**
+ * @brief Computes the exclusive prefix sum of `n` values on the device, and writes their total after them.
+ *
+ * Every work-group scans a block of the input and stores the block total, a single work-group scans the totals in
+ * chunks, and a last pass adds to every element the totals of the blocks before it. The output can alias the input.
+ *
+ * @param q The queue.
+ * @param in The `n` values, in device memory.
+ * @param out The `n + 1` prefix sums, in device memory: `out[i]` sums `in[0, i)` and `out[n]` all of them.
+ * @param n The number of values.
+ *
+ * @return An event representing the completion of the scan.
+ */
+template<typename InT, typename OutT>
+sygraph::Event exclusiveSum(sycl::queue& q, const InT* in, OutT* out, size_t n) {
+  const size_t local_size = sygraph::device::getProfile(q).compute_unit_size;
+  const size_t num_blocks = std::max<size_t>(1, (n + local_size - 1) / local_size);
+  OutT* totals = memory::detail::memoryAlloc<OutT, memory::space::device>(num_blocks + 1, q);
+
+  auto blocks_e = q.submit([&](sycl::handler& cgh) {
+    cgh.parallel_for<detail::scan_blocks_kernel<InT, OutT>>(sycl::nd_range<1>{num_blocks * local_size, local_size}, [=](sycl::nd_item<1> item) {
+      const size_t i = item.get_global_linear_id();
+      const OutT value = i < n ? static_cast<OutT>(in[i]) : OutT{};
+      const OutT inclusive = sycl::inclusive_scan_over_group(item.get_group(), value, sycl::plus<OutT>());
+      if (i < n) { out[i] = inclusive - value; }
+      if (item.get_local_linear_id() == local_size - 1) { totals[item.get_group_linear_id()] = inclusive; }
+    });
+  });
+
+  auto totals_e = q.submit([&](sycl::handler& cgh) {
+    cgh.depends_on(blocks_e);
+    cgh.parallel_for<detail::scan_totals_kernel<OutT>>(sycl::nd_range<1>{local_size, local_size}, [=](sycl::nd_item<1> item) {
+      const size_t lid = item.get_local_linear_id();
+      OutT carry{};
+      for (size_t base = 0; base < num_blocks; base += local_size) {
+        const size_t i = base + lid;
+        const OutT value = i < num_blocks ? totals[i] : OutT{};
+        const OutT inclusive = sycl::inclusive_scan_over_group(item.get_group(), value, sycl::plus<OutT>());
+        const OutT chunk_total = sycl::group_broadcast(item.get_group(), inclusive, local_size - 1);
+        if (i < num_blocks) { totals[i] = carry + inclusive - value; }
+        carry += chunk_total;
+      }
+      if (lid == 0) { totals[num_blocks] = carry; }
+    });
+  });
+
+  auto add_e = q.submit([&](sycl::handler& cgh) {
+    cgh.depends_on(totals_e);
+    cgh.parallel_for<detail::scan_add_kernel<OutT>>(sycl::range<1>{n + 1}, [=](sycl::id<1> idx) {
+      const size_t i = idx[0];
+      out[i] = i < n ? out[i] + totals[i / local_size] : totals[num_blocks];
+    });
+  });
+  add_e.wait_and_throw();
+  memory::detail::releaseUSM(totals, q);
+  return {add_e};
+}
+
+} // namespace scan
+} // namespace sygraph
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include <sycl/sycl.hpp>
+
+namespace sygraph {
+namespace sort {
+
+/**
+ * @brief Sorts `length` keys in place, carrying the values along, without extra memory.
+ *
+ * A heap sort run by a single work-item, meant for the short segments of a CSR row: the keys of a row are unique, so
+ * the order of equal keys does not matter.
+ *
+ * @param keys The keys, sorted in ascending order.
+ * @param values The values, moved together with their keys.
+ * @param length The number of keys.
+ */
+template<typename KeyT, typename ValueT>
+SYCL_EXTERNAL inline void sortByKey(KeyT* keys, ValueT* values, size_t length) {
+  auto sift_down = [&](size_t root, size_t end) {
+    while (2 * root + 1 < end) {
+      size_t child = 2 * root + 1;
+      if (child + 1 < end && keys[child] < keys[child + 1]) { child++; }
+      if (!(keys[root] < keys[child])) { return; }
+      std::swap(keys[root], keys[child]);
+      std::swap(values[root], values[child]);
+      root = child;
+    }
+  };
+  for (size_t start = length / 2; start-- > 0;) { sift_down(start, length); }
+  for (size_t end = length; end-- > 1;) {
+    std::swap(keys[0], keys[end]);
+    std::swap(values[0], values[end]);
+    sift_down(0, end);
+  }
+}
+
+} // namespace sort
+} // namespace sygraph
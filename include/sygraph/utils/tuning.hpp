@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2025 University of Salerno
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <sygraph/operators/config.hpp>
+
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sygraph {
+namespace tuning {
+
+/**
+ * @brief Launch policies chosen by the autotuner for a graph and a device.
+ *
+ * Algorithms use these values whenever the caller does not give an explicit policy. A value of `0` for the
+ * work-group size, the bitmap width or the degree thresholds keeps the one derived from the device.
+ */
+struct TuningProfile {
+  std::string device;                                                                  ///< Device the profile was tuned on, empty for any device.
+  operators::load_balancer load_balancer = operators::load_balancer::workgroup_mapped; ///< Load balancer of the advances.
+  size_t compute_unit_size = 0;                                                        ///< Work-group width of the frontier-wide kernels.
+  size_t bitmap_width = 0;                                                             ///< Bitmap word width of the frontiers, in bits.
+  float bfs_alpha = 1.0f;                                                              ///< Push to pull threshold of the hybrid BFS.
+  float bfs_beta = 1.0f;                                                               ///< Pull to push threshold of the hybrid BFS.
+  size_t workitem_max_degree = 0;                                                      ///< Largest degree the automatic balancer maps to work-items.
+  size_t bucketing_min_degree = 0;                                                     ///< Smallest degree the automatic balancer sends to bucketing.
+  size_t convergence_period = 1;                                                       ///< Iterations between two reads of the convergence flags.
+  bool command_graph = false;                                                          ///< Replays recorded iterations as command graphs.
+  size_t intersection_gallop_ratio = 8;                                                ///< Degree ratio from which intersections gallop.
+  size_t intersection_hash_min_degree = 0;                                             ///< Smallest degree intersected by a work-group hash.
+  float spmv_pull_density = 0.05f;                                                     ///< Input density from which spmv pulls instead of pushing.
+};
+
+inline std::string toString(operators::load_balancer lb) {
+  switch (lb) {
+    case operators::load_balancer::workitem_mapped: return "workitem_mapped";
+    case operators::load_balancer::subgroup_mapped: return "subgroup_mapped";
+    case operators::load_balancer::workgroup_mapped: return "workgroup_mapped";
+    case operators::load_balancer::bucketing: return "bucketing";
+    case operators::load_balancer::automatic: return "automatic";
+  }
+  throw std::runtime_error("Unknown load balancer");
+}
+
+inline operators::load_balancer parseLoadBalancer(const std::string& value) {
+  if (value == "workitem_mapped") { return operators::load_balancer::workitem_mapped; }
+  if (value == "subgroup_mapped") { return operators::load_balancer::subgroup_mapped; }
+  if (value == "workgroup_mapped") { return operators::load_balancer::workgroup_mapped; }
+  if (value == "bucketing") { return operators::load_balancer::bucketing; }
+  if (value == "automatic") { return operators::load_balancer::automatic; }
+  throw std::runtime_error("Unknown load balancer: " + value);
+}
+
+namespace detail {
+
+/**
+ * @brief Parses a flat JSON object whose values are strings or numbers.
+ */
+inline std::map<std::string, std::string> parseFlatObject(const std::string& text) {
+  std::map<std::string, std::string> values;
+  size_t pos = 0;
+  auto skip = [&]() {
+    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) { pos++; }
+  };
+  auto expect = [&](char c) {
+    skip();
+    if (pos >= text.size() || text[pos] != c) { throw std::runtime_error(std::string("Invalid tuning profile: expected '") + c + "'"); }
+    pos++;
+  };
+  auto parseString = [&]() {
+    expect('"');
+    std::string value;
+    while (pos < text.size() && text[pos] != '"') {
+      if (text[pos] == '\\' && pos + 1 < text.size()) { pos++; }
+      value += text[pos++];
+    }
+    expect('"');
+    return value;
+  };
+
+  expect('{');
+  skip();
+  if (pos < text.size() && text[pos] == '}') { return values; }
+  while (true) {
+    std::string key = parseString();
+    expect(':');
+    skip();
+    if (pos < text.size() && text[pos] == '"') {
+      values[key] = parseString();
+    } else {
+      size_t begin = pos;
+      while (pos < text.size() && text[pos] != ',' && text[pos] != '}' && !std::isspace(static_cast<unsigned char>(text[pos]))) { pos++; }
+      if (begin == pos) { throw std::runtime_error("Invalid tuning profile: missing value for " + key); }
+      values[key] = text.substr(begin, pos - begin);
+    }
+    skip();
+    if (pos < text.size() && text[pos] == ',') {
+      pos++;
+      continue;
+    }
+    expect('}');
+    return values;
+  }
+}
+
+/**
+ * @brief The active tuning profile. Installed profiles are never modified nor freed, so references to them stay valid
+ * after they are replaced.
+ */
+struct ProfileState {
+  std::mutex mutex;
+  const TuningProfile* current = nullptr;
+  std::vector<std::unique_ptr<const TuningProfile>> installed;
+  std::atomic<uint64_t> generation{0}; ///< Bumped on every change, invalidates the per-thread caches.
+
+  void install(const TuningProfile& profile) {
+    installed.push_back(std::make_unique<const TuningProfile>(profile));
+    current = installed.back().get();
+    generation.fetch_add(1, std::memory_order_release);
+  }
+};
+
+inline ProfileState& profileState() {
+  // Intentionally leaked, like the profiles it holds.
+  static auto* state = new ProfileState();
+  return *state;
+}
+
+} // namespace detail
+
+/**
+ * @brief Parses a tuning profile from its JSON representation. Missing keys keep their default value.
+ *
+ * @throws std::runtime_error If the text is not a valid profile.
+ */
+inline TuningProfile fromJSON(const std::string& text) {
+  TuningProfile profile;
+  for (const auto& [key, value] : detail::parseFlatObject(text)) {
+    try {
+      if (key == "device") {
+        profile.device = value;
+      } else if (key == "load_balancer") {
+        profile.load_balancer = parseLoadBalancer(value);
+      } else if (key == "compute_unit_size") {
+        profile.compute_unit_size = std::stoul(value);
+      } else if (key == "bitmap_width") {
+        profile.bitmap_width = std::stoul(value);
+      } else if (key == "bfs_alpha") {
+        profile.bfs_alpha = std::stof(value);
+      } else if (key == "bfs_beta") {
+        profile.bfs_beta = std::stof(value);
+      } else if (key == "workitem_max_degree") {
+        profile.workitem_max_degree = std::stoul(value);
+      } else if (key == "bucketing_min_degree") {
+        profile.bucketing_min_degree = std::stoul(value);
+      } else if (key == "convergence_period") {
+        profile.convergence_period = std::stoul(value);
+      } else if (key == "command_graph") {
+        if (value != "true" && value != "false") { throw std::runtime_error("Invalid tuning profile: command_graph must be true or false"); }
+        profile.command_graph = value == "true";
+      } else if (key == "intersection_gallop_ratio") {
+        profile.intersection_gallop_ratio = std::stoul(value);
+      } else if (key == "intersection_hash_min_degree") {
+        profile.intersection_hash_min_degree = std::stoul(value);
+      } else if (key == "spmv_pull_density") {
+        profile.spmv_pull_density = std::stof(value);
+      }
+    } catch (const std::logic_error&) { throw std::runtime_error("Invalid tuning profile: bad value for " + key); }
+  }
+  if (profile.bitmap_width != 0 && profile.bitmap_width != 32 && profile.bitmap_width != 64) {
+    throw std::runtime_error("Invalid tuning profile: bitmap_width must be 32 or 64");
+  }
+  return profile;
+}
+
+/**
+ * @brief Serializes a tuning profile to JSON.
+ */
+inline std::string toJSON(const TuningProfile& profile) {
+  std::ostringstream out;
+  out << "{\n";
+  out << "  \"device\": \"" << profile.device << "\",\n";
+  out << "  \"load_balancer\": \"" << toString(profile.load_balancer) << "\",\n";
+  out << "  \"compute_unit_size\": " << profile.compute_unit_size << ",\n";
+  out << "  \"bitmap_width\": " << profile.bitmap_width << ",\n";
+  out << "  \"bfs_alpha\": " << profile.bfs_alpha << ",\n";
+  out << "  \"bfs_beta\": " << profile.bfs_beta << ",\n";
+  out << "  \"workitem_max_degree\": " << profile.workitem_max_degree << ",\n";
+  out << "  \"bucketing_min_degree\": " << profile.bucketing_min_degree << ",\n";
+  out << "  \"convergence_period\": " << profile.convergence_period << ",\n";
+  out << "  \"command_graph\": " << (profile.command_graph ? "true" : "false") << ",\n";
+  out << "  \"intersection_gallop_ratio\": " << profile.intersection_gallop_ratio << ",\n";
+  out << "  \"intersection_hash_min_degree\": " << profile.intersection_hash_min_degree << ",\n";
+  out << "  \"spmv_pull_density\": " << profile.spmv_pull_density << "\n";
+  out << "}\n";
+  return out.str();
+}
+
+/**
+ * @brief Reads a tuning profile from a JSON file.
+ *
+ * @throws std::runtime_error If the file cannot be read or is not a valid profile.
+ */
+inline TuningProfile load(const std::string& path) {
+  std::ifstream file(path);
+  if (!file.is_open()) { throw std::runtime_error("Cannot open tuning profile " + path); }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return fromJSON(buffer.str());
+}
+
+/**
+ * @brief Writes a tuning profile to a JSON file.
+ *
+ * @throws std::runtime_error If the file cannot be written.
+ */
+inline void save(const TuningProfile& profile, const std::string& path) {
+  std::ofstream file(path);
+  if (!file.is_open()) { throw std::runtime_error("Cannot write tuning profile " + path); }
+  file << toJSON(profile);
+}
+
+/**
+ * @brief Returns the active tuning profile.
+ *
+ * On first use the profile is loaded from the file named by the `SYGRAPH_TUNING_PROFILE` environment variable, if set.
+ * Lookups are served by a per-thread cache and only take the lock after a change. The returned profile is never
+ * modified: `setProfile` installs a new one and the reference stays valid.
+ */
+inline const TuningProfile& getProfile() {
+  auto& state = detail::profileState();
+  thread_local const TuningProfile* cached = nullptr;
+  thread_local uint64_t cached_generation = 0;
+
+  if (cached != nullptr && cached_generation == state.generation.load(std::memory_order_acquire)) { return *cached; }
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.current == nullptr) {
+    const char* path = std::getenv("SYGRAPH_TUNING_PROFILE");
+    state.install((path != nullptr && *path != '\0') ? load(path) : TuningProfile{});
+  }
+  cached = state.current;
+  cached_generation = state.generation.load(std::memory_order_relaxed);
+  return *cached;
+}
+
+/**
+ * @brief Replaces the active tuning profile.
+ *
+ * Device profiles queried afterwards pick up the work-group size and bitmap width overrides, a device profile that is
+ * already cached is refreshed by `device::resetProfile`.
+ */
+inline void setProfile(const TuningProfile& profile) {
+  auto& state = detail::profileState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.install(profile);
+}
+
+/**
+ * @brief Restores the default tuning profile, ignoring the environment.
+ */
+inline void resetProfile() { setProfile(TuningProfile{}); }
+
+} // namespace tuning
+} // namespace sygraph
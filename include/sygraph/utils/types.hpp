@@ -5,12 +5,22 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+
+// Defaults used when the build system does not provide them. Both can be changed at runtime through the device profile.
+#ifndef BITMAP_SIZE
+#define BITMAP_SIZE 32
+#endif
+#ifndef CU_SIZE
+#define CU_SIZE 512
+#endif
 
 namespace sygraph {
 namespace types {
 
 typedef unsigned int index_t;
 typedef size_t offset_t;
+// Default bitmap word of the frontiers. Frontiers of the other width are selected at runtime, see frontier::FrontierPair.
 #if BITMAP_SIZE == 32
 typedef uint32_t bitmap_type_t;
 #elif BITMAP_SIZE == 64
@@ -16,7 +16,7 @@ namespace sygraph {
 template<typename T>
 class Vector {
 public:
-  Vector(sycl::queue& q, size_t size) : _q(q), _data(sycl::malloc_shared<T>(size, q)), _size(size) {}
+  Vector(sycl::queue& q, size_t size) : _q(q), _data(memory::detail::memoryAlloc<T, memory::space::shared>(size, q)), _size(size) {}
 
   Vector(const Vector&) = delete;
   Vector& operator=(const Vector&) = delete;
@@ -26,4 +26,31 @@ int main() {
   auto hybrid_details = bfs_hybrid.run(sygraph::algorithms::bfs_direction::hybrid, 1.0f, 1.0f);
   sygraph::tests::expectEqual(bfs_hybrid.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
   assert(hybrid_details.iterations == 5);
+
+  // a second source on the same object reuses its buffers and frontiers
+  uint middle = 2;
+  bfs_hybrid.init(middle);
+  bfs_hybrid.run(sygraph::algorithms::bfs_direction::push);
+  sygraph::tests::expectEqual(bfs_hybrid.getDistances(), std::array<uint, 5>{2, 1, 0, 1, 2});
+  bfs_hybrid.init(source);
+  bfs_hybrid.run(sygraph::algorithms::bfs_direction::pull);
+  sygraph::tests::expectEqual(bfs_hybrid.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+
+  bfs_hybrid.reset();
+
+  // the persistent kernel launches the work-groups the device keeps resident, or falls back to the push traversal
+  sygraph::algorithms::BFS bfs_persistent(graph);
+  bfs_persistent.init(source);
+  auto persistent_details = bfs_persistent.run(sygraph::algorithms::bfs_direction::persistent);
+  sygraph::tests::expectEqual(bfs_persistent.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+  assert(persistent_details.iterations == 5);
+  assert(persistent_details.push_steps.size() == 5);
+
+  // the visited vertices are cleared, so the next run starts from the new source alone
+  bfs_persistent.init(middle);
+  bfs_persistent.run(sygraph::algorithms::bfs_direction::persistent);
+  sygraph::tests::expectEqual(bfs_persistent.getDistances(), std::array<uint, 5>{2, 1, 0, 1, 2});
+  bfs_persistent.init(source);
+  bfs_persistent.run(sygraph::algorithms::bfs_direction::push);
+  sygraph::tests::expectEqual(bfs_persistent.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
 }
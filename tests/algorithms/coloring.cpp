@@ -0,0 +1,83 @@
+#include "test_utils.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// checks that no edge joins two vertices of the same color, and that the classes group the vertices by color
+template<typename GraphT>
+size_t checkColoring(sycl::queue& q, GraphT& graph) {
+  const size_t n = graph.getVertexCount();
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  sygraph::algorithms::Coloring coloring(graph);
+  coloring.init();
+  coloring.run();
+
+  std::vector<uint32_t> colors(n);
+  std::vector<uint> classes(n);
+  q.copy(coloring.getColors(), colors.data(), n).wait();
+  q.copy(coloring.getColorClasses(), classes.data(), n).wait();
+  size_t max_degree = 0;
+  for (size_t v = 0; v < n; ++v) {
+    max_degree = std::max<size_t>(max_degree, offsets[v + 1] - offsets[v]);
+    for (auto e = offsets[v]; e < offsets[v + 1]; ++e) { assert(columns[e] == v || colors[columns[e]] != colors[v]); }
+  }
+  assert(coloring.getColorCount() <= max_degree + 1);
+
+  const auto& class_offsets = coloring.getColorOffsets();
+  assert(class_offsets.size() == coloring.getColorCount() + 1);
+  assert(class_offsets.back() == n);
+  for (size_t c = 0; c < coloring.getColorCount(); ++c) {
+    assert(class_offsets[c] < class_offsets[c + 1]);
+    for (size_t i = class_offsets[c]; i < class_offsets[c + 1]; ++i) { assert(colors[classes[i]] == c); }
+  }
+  std::sort(classes.begin(), classes.end());
+  for (size_t v = 0; v < n; ++v) { assert(classes[v] == v); }
+
+  // the instance is reset in place when it is reused
+  coloring.init();
+  coloring.run();
+  std::vector<uint32_t> again(n);
+  q.copy(coloring.getColors(), again.data(), n).wait();
+  for (size_t v = 0; v < n; ++v) {
+    for (auto e = offsets[v]; e < offsets[v + 1]; ++e) { assert(columns[e] == v || again[columns[e]] != again[v]); }
+  }
+  return coloring.getColorCount();
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  auto triangle = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::triangle_3);
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  assert(checkColoring(q, triangle) == 3);
+  assert(checkColoring(q, line) == 2);
+  assert(checkColoring(q, star) == 2);
+
+  // a self-loop is not a conflict, and an isolated vertex gets the first color
+  auto loops = sygraph::tests::buildGraphFromMatrix(q,
+                                                    "4\n"
+                                                    "1 1 0 0\n"
+                                                    "1 0 1 0\n"
+                                                    "0 1 1 0\n"
+                                                    "0 0 0 0");
+  assert(checkColoring(q, loops) == 2);
+
+  // the clique needs one color per vertex, beyond the first 64-color mask
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(160, 159, 70));
+  assert(checkColoring(q, dense) >= 70);
+
+  sygraph::graph::Properties properties;
+  properties.directed = true;
+  auto directed = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  sygraph::algorithms::Coloring directed_coloring(directed);
+  bool thrown = false;
+  try {
+    directed_coloring.init();
+  } catch (const std::runtime_error&) { thrown = true; }
+  assert(thrown);
+}
@@ -0,0 +1,81 @@
+#include "test_utils.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// the core numbers computed on the host by peeling a vertex of minimum degree at a time
+template<typename GraphT>
+std::vector<uint32_t> expectedCoreness(const GraphT& graph) {
+  const size_t n = graph.getVertexCount();
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  std::vector<uint32_t> degrees(n);
+  std::vector<uint32_t> coreness(n, 0);
+  std::vector<bool> peeled(n, false);
+  for (size_t v = 0; v < n; ++v) { degrees[v] = offsets[v + 1] - offsets[v]; }
+  uint32_t k = 0;
+  for (size_t step = 0; step < n; ++step) {
+    size_t next = n;
+    for (size_t v = 0; v < n; ++v) {
+      if (!peeled[v] && (next == n || degrees[v] < degrees[next])) { next = v; }
+    }
+    k = std::max(k, degrees[next]);
+    coreness[next] = k;
+    peeled[next] = true;
+    for (auto e = offsets[next]; e < offsets[next + 1]; ++e) {
+      if (!peeled[columns[e]]) { degrees[columns[e]]--; }
+    }
+  }
+  return coreness;
+}
+
+template<typename GraphT>
+void checkCoreness(GraphT& graph) {
+  sygraph::algorithms::KCore kcore(graph);
+  kcore.init();
+  kcore.run();
+  const auto expected = expectedCoreness(graph);
+  for (size_t v = 0; v < graph.getVertexCount(); ++v) { assert(kcore.getCoreness(v) == expected[v]); }
+  assert(kcore.getMaxCoreness() == *std::max_element(expected.begin(), expected.end()));
+
+  // the buffers and frontiers are reset when the instance is reused
+  kcore.init();
+  kcore.run();
+  for (size_t v = 0; v < graph.getVertexCount(); ++v) { assert(kcore.getCoreness(v) == expected[v]); }
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  auto triangle = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::triangle_3);
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  checkCoreness(triangle);
+  checkCoreness(line);
+  checkCoreness(star);
+
+  // a complete graph on 5 vertices with a pendant vertex and an isolated one
+  auto pendant = sygraph::tests::buildGraphFromMatrix(q,
+                                                      "7\n"
+                                                      "0 1 1 1 1 1 0\n"
+                                                      "1 0 1 1 1 0 0\n"
+                                                      "1 1 0 1 1 0 0\n"
+                                                      "1 1 1 0 1 0 0\n"
+                                                      "1 1 1 1 0 0 0\n"
+                                                      "1 0 0 0 0 0 0\n"
+                                                      "0 0 0 0 0 0 0");
+  sygraph::algorithms::KCore kcore(pendant);
+  kcore.init();
+  kcore.run();
+  for (size_t v = 0; v < 5; ++v) { assert(kcore.getCoreness(v) == 4); }
+  assert(kcore.getCoreness(5) == 1);
+  assert(kcore.getCoreness(6) == 0);
+  assert(kcore.getMaxCoreness() == 4);
+
+  // a small clique on top of the hub, so that the cores are nested several levels deep
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(40, 0, 8));
+  checkCoreness(dense);
+}
@@ -0,0 +1,102 @@
+#include "test_utils.hpp"
+
+#include <map>
+#include <numeric>
+
+namespace {
+
+// the labels computed on the host by updating all vertices at every iteration, with the same tie rule
+template<typename GraphT>
+std::vector<uint> expectedLabels(const GraphT& graph, bool synchronous, size_t max_iterations) {
+  const size_t n = graph.getVertexCount();
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  std::vector<uint> labels(n);
+  std::iota(labels.begin(), labels.end(), 0);
+  for (size_t iteration = 0; iteration < max_iterations; ++iteration) {
+    bool changed = false;
+    for (size_t half = 0; half < (synchronous ? 1 : 2); ++half) {
+      std::vector<uint> next = labels;
+      for (size_t v = 0; v < n; ++v) {
+        if (!synchronous && v % 2 != half) { continue; }
+        std::map<uint, size_t> counts;
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e) { counts[labels[columns[e]]]++; }
+        size_t best_count = 0;
+        for (const auto& [label, count] : counts) {
+          if (count > best_count) {
+            best_count = count;
+            next[v] = label;
+          }
+        }
+        if (counts.count(labels[v]) != 0 && counts[labels[v]] == best_count) { next[v] = labels[v]; }
+      }
+      changed = changed || next != labels;
+      labels = next;
+    }
+    if (!changed) { break; }
+  }
+  return labels;
+}
+
+template<typename GraphT>
+void checkLabels(sycl::queue& q, GraphT& graph, sygraph::algorithms::lpa_mode mode, size_t max_iterations = 100) {
+  sygraph::algorithms::LabelPropagation lpa(graph);
+  lpa.setMode(mode);
+  lpa.setMaxIterations(max_iterations);
+  const auto expected = expectedLabels(graph, mode == sygraph::algorithms::lpa_mode::synchronous, max_iterations);
+  std::vector<uint> labels(graph.getVertexCount());
+  for (int run = 0; run < 2; ++run) {
+    // the instance is reset in place when it is reused
+    lpa.init();
+    lpa.run();
+    q.copy(lpa.getLabels(), labels.data(), labels.size()).wait();
+    sygraph::tests::expectEqual(labels, expected);
+    assert(lpa.getIterationCount() <= max_iterations);
+  }
+}
+
+void checkGraphs(sycl::queue& q) {
+  using mode_t = sygraph::algorithms::lpa_mode;
+
+  // a synchronous star oscillates between the labels of the hub and of a leaf, until the iterations run out
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  checkLabels(q, star, mode_t::synchronous, 7);
+  checkLabels(q, star, mode_t::semi_synchronous);
+  sygraph::algorithms::LabelPropagation star_lpa(star);
+  star_lpa.init();
+  star_lpa.run();
+  for (size_t v = 0; v < 5; ++v) { assert(star_lpa.getLabel(v) == star_lpa.getLabel(0)); }
+
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  checkLabels(q, line, mode_t::synchronous);
+  checkLabels(q, line, mode_t::semi_synchronous);
+
+  // the cliques of a ring keep their own labels
+  auto ring = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildCliques(4, 6));
+  checkLabels(q, ring, mode_t::synchronous);
+  checkLabels(q, ring, mode_t::semi_synchronous);
+  sygraph::algorithms::LabelPropagation ring_lpa(ring);
+  ring_lpa.init();
+  ring_lpa.run();
+  for (size_t v = 0; v < 24; ++v) { assert(ring_lpa.getLabel(v) == ring_lpa.getLabel((v / 6) * 6 + 1)); }
+  assert(ring_lpa.getLabel(1) != ring_lpa.getLabel(7));
+
+  // vertices of degree above the work-item limit, with degrees that are not powers of two
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(150, 0, 50));
+  checkLabels(q, dense, mode_t::synchronous, 20);
+  checkLabels(q, dense, mode_t::semi_synchronous);
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+  checkGraphs(q);
+
+  // small work-groups make the sort of the neighbor labels span several rounds per work-item
+  auto profile = sygraph::device::getProfile(q);
+  profile.compute_unit_size = 8;
+  sygraph::device::setProfile(q, profile);
+  checkGraphs(q);
+  sygraph::device::resetProfile(q);
+}
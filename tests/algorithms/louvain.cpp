@@ -0,0 +1,127 @@
+#include "test_utils.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <set>
+
+namespace {
+
+template<typename LouvainT>
+std::vector<uint> communities(sycl::queue& q, LouvainT& louvain, size_t n) {
+  std::vector<uint> host(n);
+  q.copy(louvain.getCommunities(), host.data(), n).wait();
+  return host;
+}
+
+// the modularity of a partition computed on the host, from its definition
+template<typename GraphT>
+double expectedModularity(const GraphT& graph, const std::vector<uint>& community) {
+  const size_t n = graph.getVertexCount();
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  const auto* values = graph.getValues();
+  std::vector<double> totals(n, 0.0);
+  double total = 0.0;
+  double internal = 0.0;
+  for (size_t v = 0; v < n; ++v) {
+    for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+      totals[community[v]] += values[e];
+      total += values[e];
+      if (community[columns[e]] == community[v]) { internal += values[e]; }
+    }
+  }
+  double squares = 0.0;
+  for (double t : totals) { squares += t * t; }
+  return (internal / total) - (squares / (total * total));
+}
+
+template<typename GraphT>
+std::vector<uint> checkLouvain(sycl::queue& q, GraphT& graph) {
+  sygraph::algorithms::Louvain louvain(graph);
+  louvain.init();
+  louvain.run();
+  const size_t n = graph.getVertexCount();
+  auto result = communities(q, louvain, n);
+  // the communities are numbered densely, and the modularity is the one of the returned partition
+  assert(std::set<uint>(result.begin(), result.end()).size() == louvain.getCommunityCount());
+  for (uint c : result) { assert(c < louvain.getCommunityCount()); }
+  assert(std::abs(louvain.getModularity() - expectedModularity(graph, result)) < 1e-4);
+  // moves that lower the modularity are undone, so the partition is never worse than the singletons
+  std::vector<uint> singletons(n);
+  std::iota(singletons.begin(), singletons.end(), 0U);
+  assert(louvain.getModularity() >= expectedModularity(graph, singletons) - 1e-4);
+
+  // the instance is reset in place when it is reused, and finds the same communities
+  louvain.init();
+  louvain.run();
+  sygraph::tests::expectEqual(communities(q, louvain, n), result);
+  return result;
+}
+
+void checkCommunities(sycl::queue& q) {
+  // two cliques joined by an edge are two communities
+  auto pair = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildCliques(2, 4));
+  auto pair_communities = checkLouvain(q, pair);
+  for (size_t v = 0; v < 8; ++v) { assert(pair_communities[v] == pair_communities[v < 4 ? 0 : 4]); }
+  assert(pair_communities[0] != pair_communities[4]);
+
+  // a ring of cliques is contracted over several levels into one community per clique
+  auto ring = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildCliques(6, 5));
+  auto ring_communities = checkLouvain(q, ring);
+  for (size_t v = 0; v < 30; ++v) { assert(ring_communities[v] == ring_communities[(v / 5) * 5]); }
+  assert(std::set<uint>(ring_communities.begin(), ring_communities.end()).size() == 6);
+
+  // the weights decide how a cycle splits
+  sygraph::graph::Properties properties;
+  properties.weighted = true;
+  auto cycle = sygraph::tests::buildGraphFromMatrix(q,
+                                                    "4\n"
+                                                    "0 9 0 1\n"
+                                                    "9 0 1 0\n"
+                                                    "0 1 0 9\n"
+                                                    "1 0 9 0",
+                                                    properties);
+  auto cycle_communities = checkLouvain(q, cycle);
+  assert(cycle_communities[0] == cycle_communities[1] && cycle_communities[2] == cycle_communities[3]);
+  assert(cycle_communities[0] != cycle_communities[2]);
+
+  // without edges every vertex stays alone
+  auto empty = sygraph::tests::buildGraphFromMatrix(q, "3\n0 0 0\n0 0 0\n0 0 0");
+  sygraph::algorithms::Louvain empty_louvain(empty);
+  empty_louvain.init();
+  empty_louvain.run();
+  assert(empty_louvain.getCommunityCount() == 3);
+  assert(empty_louvain.getModularity() == 0.0f);
+
+  // a hub of degree larger than the local tables of small work-groups, and a positive modularity
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(200));
+  auto dense_communities = checkLouvain(q, dense);
+  assert(std::set<uint>(dense_communities.begin(), dense_communities.end()).size() < dense.getVertexCount());
+  assert(expectedModularity(dense, dense_communities) > 0.0);
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+  checkCommunities(q);
+
+  // small work-groups get small local tables, which the hub does not fit
+  auto profile = sygraph::device::getProfile(q);
+  profile.compute_unit_size = 8;
+  sygraph::device::setProfile(q, profile);
+  checkCommunities(q);
+  sygraph::device::resetProfile(q);
+
+  // directed graphs are rejected
+  sygraph::graph::Properties properties;
+  properties.weighted = true;
+  properties.directed = true;
+  auto directed = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  sygraph::algorithms::Louvain directed_louvain(directed);
+  bool thrown = false;
+  try {
+    directed_louvain.init();
+  } catch (const std::runtime_error&) { thrown = true; }
+  assert(thrown);
+}
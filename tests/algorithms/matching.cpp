@@ -0,0 +1,84 @@
+#include "test_utils.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// checks that the mates are symmetric neighbors, and that no edge joins two unmatched vertices
+template<typename GraphT>
+std::vector<uint> checkMatching(sycl::queue& q, GraphT& graph, uint64_t seed) {
+  using matching_t = sygraph::algorithms::Matching<GraphT>;
+  const size_t n = graph.getVertexCount();
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  matching_t matching(graph);
+  matching.setSeed(seed);
+  matching.init();
+  matching.run();
+
+  std::vector<uint> mates(n);
+  q.copy(matching.getMates(), mates.data(), n).wait();
+  size_t matched = 0;
+  for (size_t v = 0; v < n; ++v) {
+    assert(matching.getMate(v) == mates[v]);
+    if (mates[v] == matching_t::unmatched) {
+      for (auto e = offsets[v]; e < offsets[v + 1]; ++e) { assert(columns[e] == v || mates[columns[e]] != matching_t::unmatched); }
+      continue;
+    }
+    matched++;
+    assert(mates[v] != v);
+    assert(mates[mates[v]] == v);
+    assert(std::find(columns + offsets[v], columns + offsets[v + 1], mates[v]) != columns + offsets[v + 1]);
+  }
+  assert(matching.getSize() * 2 == matched);
+
+  // the instance is reset in place when it is reused, and the same seed gives the same matching
+  matching.init();
+  matching.run();
+  std::vector<uint> again(n);
+  q.copy(matching.getMates(), again.data(), n).wait();
+  sygraph::tests::expectEqual(again, mates);
+  return mates;
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  auto triangle = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::triangle_3);
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  for (uint64_t seed = 0; seed < 4; ++seed) {
+    auto triangle_mates = checkMatching(q, triangle, seed);
+    assert(std::count(triangle_mates.begin(), triangle_mates.end(), sygraph::algorithms::Matching<decltype(triangle)>::unmatched) == 1);
+    checkMatching(q, line, seed);
+    // the hub is matched to one of the leaves
+    auto star_mates = checkMatching(q, star, seed);
+    assert(star_mates[0] != sygraph::algorithms::Matching<decltype(star)>::unmatched);
+  }
+
+  // self-loops are never matched, and an isolated vertex stays unmatched
+  auto loops = sygraph::tests::buildGraphFromMatrix(q,
+                                                    "4\n"
+                                                    "1 1 0 0\n"
+                                                    "1 0 1 0\n"
+                                                    "0 1 1 0\n"
+                                                    "0 0 0 0");
+  auto loops_mates = checkMatching(q, loops, 1);
+  assert(loops_mates[3] == sygraph::algorithms::Matching<decltype(loops)>::unmatched);
+
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(120));
+  checkMatching(q, dense, 7);
+  checkMatching(q, dense, 8);
+
+  sygraph::graph::Properties properties;
+  properties.directed = true;
+  auto directed = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  sygraph::algorithms::Matching directed_matching(directed);
+  bool thrown = false;
+  try {
+    directed_matching.init();
+  } catch (const std::runtime_error&) { thrown = true; }
+  assert(thrown);
+}
@@ -0,0 +1,81 @@
+#include "test_utils.hpp"
+
+namespace {
+
+// checks that no edge joins two vertices of the set, and that every vertex out of it has a neighbor in it
+template<typename GraphT>
+std::vector<uint32_t> checkSet(sycl::queue& q, GraphT& graph, uint64_t seed) {
+  const size_t n = graph.getVertexCount();
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  sygraph::algorithms::MIS mis(graph);
+  mis.setSeed(seed);
+  mis.init();
+  mis.run();
+
+  std::vector<uint32_t> members(n);
+  q.copy(mis.getMembers(), members.data(), n).wait();
+  size_t size = 0;
+  for (size_t v = 0; v < n; ++v) {
+    bool covered = members[v] != 0;
+    for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+      if (columns[e] == v) { continue; }
+      assert(members[v] == 0 || members[columns[e]] == 0);
+      covered = covered || members[columns[e]] != 0;
+    }
+    assert(covered);
+    assert(mis.contains(v) == (members[v] != 0));
+    size += members[v];
+  }
+  assert(mis.getSize() == size);
+
+  // the instance is reset in place when it is reused, and the same seed gives the same set
+  mis.init();
+  mis.run();
+  std::vector<uint32_t> again(n);
+  q.copy(mis.getMembers(), again.data(), n).wait();
+  sygraph::tests::expectEqual(again, members);
+  return members;
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  auto triangle = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::triangle_3);
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  for (uint64_t seed = 0; seed < 4; ++seed) {
+    auto triangle_set = checkSet(q, triangle, seed);
+    assert(triangle_set[0] + triangle_set[1] + triangle_set[2] == 1);
+    checkSet(q, line, seed);
+    // either the hub alone or all the leaves
+    auto star_set = checkSet(q, star, seed);
+    assert(star_set[0] == 1 || (star_set[1] + star_set[2] + star_set[3] + star_set[4] == 4));
+  }
+
+  // a self-loop does not keep a vertex out of the set, and an isolated vertex is always in it
+  auto loops = sygraph::tests::buildGraphFromMatrix(q,
+                                                    "4\n"
+                                                    "1 1 0 0\n"
+                                                    "1 0 1 0\n"
+                                                    "0 1 1 0\n"
+                                                    "0 0 0 0");
+  auto loops_set = checkSet(q, loops, 1);
+  assert(loops_set[3] == 1);
+
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(120));
+  checkSet(q, dense, 7);
+  checkSet(q, dense, 8);
+
+  sygraph::graph::Properties properties;
+  properties.directed = true;
+  auto directed = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  sygraph::algorithms::MIS directed_mis(directed);
+  bool thrown = false;
+  try {
+    directed_mis.init();
+  } catch (const std::runtime_error&) { thrown = true; }
+  assert(thrown);
+}
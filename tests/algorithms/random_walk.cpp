@@ -0,0 +1,100 @@
+#include "test_utils.hpp"
+
+#include <algorithm>
+
+namespace {
+
+template<typename GraphT>
+std::vector<uint> walk(sycl::queue& q,
+                       sygraph::algorithms::RandomWalk<GraphT>& walker,
+                       const std::vector<uint>& starts,
+                       size_t length,
+                       uint64_t seed) {
+  auto starts_dev = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::device>(starts.size(), q);
+  auto walks_dev = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::device>(starts.size() * length, q);
+  q.copy(starts.data(), starts_dev, starts.size()).wait();
+  walker.init(starts_dev, starts.size(), length, walks_dev, seed);
+  walker.run();
+  std::vector<uint> walks(starts.size() * length);
+  q.copy(walks_dev, walks.data(), walks.size()).wait();
+  sygraph::memory::detail::releaseUSM(starts_dev, q);
+  sygraph::memory::detail::releaseUSM(walks_dev, q);
+  return walks;
+}
+
+// every step of a walk follows an edge, and a walk stuck at a sink is padded with the invalid vertex
+template<typename GraphT>
+void checkWalks(GraphT& graph, const std::vector<uint>& walks, size_t length) {
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  constexpr uint invalid = sygraph::algorithms::RandomWalk<GraphT>::invalid_vertex;
+  for (size_t w = 0; w < walks.size() / length; ++w) {
+    for (size_t step = 1; step < length; ++step) {
+      const uint from = walks[(w * length) + step - 1];
+      const uint to = walks[(w * length) + step];
+      if (from == invalid || offsets[from] == offsets[from + 1]) {
+        assert(to == invalid);
+        continue;
+      }
+      assert(std::find(columns + offsets[from], columns + offsets[from + 1], to) != columns + offsets[from + 1]);
+    }
+  }
+}
+
+} // namespace
+
+int main() {
+  using bias_t = sygraph::algorithms::walk_bias;
+  auto q = sygraph::tests::makeQueue();
+
+  // uniform walks follow the edges, and the same seed gives the same walks
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  sygraph::algorithms::RandomWalk line_walker(line);
+  const std::vector<uint> starts{0, 1, 2, 3, 4, 2, 2, 2};
+  auto walks = walk(q, line_walker, starts, 8, 3);
+  checkWalks(line, walks, 8);
+  sygraph::tests::expectEqual(walk(q, line_walker, starts, 8, 3), walks);
+
+  // walks of a directed graph end at its sink
+  sygraph::graph::Properties properties;
+  properties.weighted = true;
+  properties.directed = true;
+  auto directed = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  sygraph::algorithms::RandomWalk directed_walker(directed);
+  directed_walker.setBias(bias_t::weighted);
+  auto directed_walks = walk(q, directed_walker, {0, 0, 1, 3, 4}, 6, 11);
+  checkWalks(directed, directed_walks, 6);
+  assert(directed_walks[(4 * 6) + 1] == sygraph::algorithms::RandomWalk<decltype(directed)>::invalid_vertex);
+
+  // the heavy edge of the hub is taken far more often by weighted walks than by uniform ones
+  properties.directed = false;
+  auto hub = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(40, 0, 0, [](size_t i, size_t j) { return i == 0 && j == 1 ? 1000 : 1; }), properties);
+  sygraph::algorithms::RandomWalk hub_walker(hub);
+  const std::vector<uint> hub_starts(256, 0);
+  auto count_heavy = [&](const std::vector<uint>& walks) {
+    size_t heavy = 0;
+    for (size_t w = 0; w < hub_starts.size(); ++w) { heavy += walks[(w * 2) + 1] == 1 ? 1 : 0; }
+    return heavy;
+  };
+  assert(count_heavy(walk(q, hub_walker, hub_starts, 2, 5)) < 32);
+  hub_walker.setBias(bias_t::weighted);
+  assert(count_heavy(walk(q, hub_walker, hub_starts, 2, 5)) > 224);
+
+  // node2vec with a huge return parameter never goes back while it can go on, so walks of a line sweep it
+  sygraph::algorithms::RandomWalk sweep_walker(line);
+  sweep_walker.setBias(bias_t::node2vec);
+  sweep_walker.setNode2VecParameters(1e9f, 1.0f);
+  sygraph::tests::expectEqual(walk(q, sweep_walker, {0, 4}, 6, 9), std::vector<uint>{0, 1, 2, 3, 4, 3, 4, 3, 2, 1, 0, 1});
+
+  // on a star, a walk through the hub never returns to the leaf it came from
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  sygraph::algorithms::RandomWalk star_walker(star);
+  star_walker.setBias(bias_t::node2vec);
+  star_walker.setNode2VecParameters(1e9f, 0.5f);
+  auto star_walks = walk(q, star_walker, std::vector<uint>(64, 1), 5, 13);
+  checkWalks(star, star_walks, 5);
+  for (size_t w = 0; w < 64; ++w) {
+    assert(star_walks[(w * 5) + 2] != star_walks[(w * 5)]);
+    assert(star_walks[(w * 5) + 4] != star_walks[(w * 5) + 2]);
+  }
+}
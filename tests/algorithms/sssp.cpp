@@ -16,4 +16,10 @@ int main() {
   for (size_t i = 0; i < distances.size(); ++i) { distances[i] = sssp.getDistance(i); }
 
   sygraph::tests::expectEqual(distances, std::array<uint, 5>{0, 1, 3, 4, 5});
+
+  uint second_source = 2;
+  sssp.init(second_source);
+  sssp.run();
+  for (size_t i = 0; i < distances.size(); ++i) { distances[i] = sssp.getDistance(i); }
+  sygraph::tests::expectEqual(distances, std::array<uint, 5>{6, 6, 0, 1, 2});
 }
@@ -9,4 +9,22 @@ int main() {
   tc.run();
 
   assert(tc.getNumTriangles() == 1);
+
+  // the complete graph on 5 vertices holds C(5, 3) triangles
+  auto complete = sygraph::tests::buildGraphFromMatrix(q,
+                                                       "5\n"
+                                                       "0 1 1 1 1\n"
+                                                       "1 0 1 1 1\n"
+                                                       "1 1 0 1 1\n"
+                                                       "1 1 1 0 1\n"
+                                                       "1 1 1 1 0");
+  sygraph::algorithms::TC complete_tc(complete);
+  complete_tc.init();
+  complete_tc.run();
+  assert(complete_tc.getNumTriangles() == 10);
+
+  // the counters are cleared when an instance is reused
+  tc.init();
+  tc.run();
+  assert(tc.getNumTriangles() == 1);
 }
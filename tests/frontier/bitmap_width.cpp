@@ -0,0 +1,43 @@
+#include "test_utils.hpp"
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+
+  // 64-bit frontiers can be instantiated next to the default ones
+  using frontier_view_t = sygraph::frontier::frontier_view;
+  using frontier_type_t = sygraph::frontier::frontier_type;
+  auto frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_type_t::mlb, uint64_t>(q, graph);
+  assert(frontier.getBitmapRange() == 64);
+  frontier.insert(0);
+  frontier.insert(4);
+  sygraph::tests::expectFrontier(frontier, std::vector<uint>{0, 4});
+
+  // the word width and the work-group width follow the device profile
+  auto tuned = sygraph::device::getProfile(q);
+  tuned.bitmap_width = 64;
+  tuned.compute_unit_size = 64;
+  sygraph::device::setProfile(q, tuned);
+  assert(sygraph::frontier::dispatchBitmapWidth(q, []<typename B>() { return sizeof(B); }) == sizeof(uint64_t));
+
+  sygraph::frontier::FrontierPair<uint> pair(q, graph.getVertexCount());
+  assert(pair.getBitmapWidth() == 64);
+
+  sygraph::algorithms::BFS bfs(graph);
+  uint source = 2;
+  bfs.init(source);
+  bfs.run();
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{2, 1, 0, 1, 2});
+
+  tuned.bitmap_width = 16;
+  sygraph::device::setProfile(q, tuned);
+  bool thrown = false;
+  try {
+    sygraph::frontier::FrontierPair<uint> invalid(q, graph.getVertexCount());
+  } catch (const std::runtime_error&) { thrown = true; }
+  assert(thrown);
+
+  sygraph::device::resetProfile(q);
+  sygraph::frontier::FrontierPair<uint> restored(q, graph.getVertexCount());
+  assert(restored.getBitmapWidth() == sygraph::device::getProfile(q).bitmap_width);
+}
@@ -0,0 +1,108 @@
+#include "test_utils.hpp"
+
+int main() {
+  auto q = sygraph::tests::makeQueue(sycl::property::queue::in_order{});
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+
+  // the emptiness of a frontier can be written to a host-pinned flag without waiting
+  using frontier_view_t = sygraph::frontier::frontier_view;
+  using frontier_type_t = sygraph::frontier::frontier_type;
+  auto frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_type_t::mlb>(q, graph);
+  auto flag = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::host>(1, q);
+  frontier.empty(flag).wait();
+  assert(*flag == 1);
+  frontier.insert(3);
+  frontier.empty(flag).wait();
+  assert(*flag == 0);
+  frontier.clear();
+  frontier.empty(flag).wait();
+  assert(*flag == 1);
+  sygraph::memory::detail::releaseUSM(flag, q);
+
+  // the flags are read every period calls, counting the iterations that had work
+  sygraph::frontier::ConvergenceCheck check(q, 3);
+  assert(check.asynchronous());
+  frontier.insert(1);
+  assert(!check.converged(frontier));
+  assert(!check.converged(frontier));
+  frontier.clear();
+  assert(check.converged(frontier));
+  assert(check.getIterations() == 2);
+  check.reset();
+  assert(check.getIterations() == 0);
+
+  // bodies that write the flags themselves read a whole period at once
+  check.reset(2);
+  assert(check.period() == 2);
+  frontier.insert(1);
+  frontier.empty(check.slot(0));
+  frontier.clear();
+  frontier.empty(check.slot(1));
+  assert(check.collect());
+  assert(check.getIterations() == 1);
+
+  auto out_of_order = sygraph::tests::makeQueue();
+  sygraph::frontier::ConvergenceCheck blocking(out_of_order, 3);
+  assert(!blocking.asynchronous());
+
+  // algorithms run ahead of the check and report the same results
+  sygraph::tuning::TuningProfile tuning;
+  tuning.convergence_period = 4;
+  sygraph::tuning::setProfile(tuning);
+
+  sygraph::algorithms::BFS bfs(graph);
+  uint source = 0;
+  bfs.init(source);
+  auto details = bfs.run(sygraph::algorithms::bfs_direction::push);
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+  assert(details.iterations == 5);
+  assert(details.push_steps.size() == 5);
+
+  bfs.init(source);
+  details = bfs.run(sygraph::algorithms::bfs_direction::pull);
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+  assert(details.iterations == 5);
+
+  auto two_cc = sygraph::tests::buildGraphFromMatrix(q, sygraph::io::storage::matrices::two_cc);
+  sygraph::algorithms::CC cc(two_cc);
+  cc.init(source);
+  cc.run();
+  sygraph::tests::expectEqual(cc.getLabels(), std::array<uint, 6>{4, 4, 4, 4, 4, 5});
+
+  // iteration bodies are replayed from command graphs where supported, and run eagerly elsewhere
+  sygraph::IterationGraph replay(q);
+  size_t calls = 0;
+  for (size_t i = 0; i < 3; i++) {
+    replay.run([&]() { calls++; });
+  }
+  assert(calls == (replay.enabled() ? 1 : 3));
+  assert(!sygraph::IterationGraph(out_of_order).enabled());
+
+  tuning.convergence_period = 1;
+  tuning.command_graph = true;
+  sygraph::tuning::setProfile(tuning);
+  bfs.init(source);
+  details = bfs.run(sygraph::algorithms::bfs_direction::push);
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+  assert(details.iterations == 5);
+  bfs.init(source);
+  details = bfs.run(sygraph::algorithms::bfs_direction::pull);
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+  assert(details.pull_steps.size() == 5);
+  cc.init(source);
+  cc.run();
+  sygraph::tests::expectEqual(cc.getLabels(), std::array<uint, 6>{4, 4, 4, 4, 4, 5});
+
+  // an odd period records one more iteration per replay
+  tuning.convergence_period = 3;
+  sygraph::tuning::setProfile(tuning);
+  bfs.init(source);
+  details = bfs.run(sygraph::algorithms::bfs_direction::push);
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+  assert(details.iterations == 5);
+  assert(details.push_steps.size() == 5);
+  cc.init(source);
+  cc.run();
+  sygraph::tests::expectEqual(cc.getLabels(), std::array<uint, 6>{4, 4, 4, 4, 4, 5});
+  sygraph::tuning::resetProfile();
+}
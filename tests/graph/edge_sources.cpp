@@ -0,0 +1,56 @@
+#include "test_utils.hpp"
+
+namespace {
+
+template<sygraph::memory::space Space>
+void checkEdgeSources(sycl::queue& q, std::string_view matrix, sygraph::graph::Properties properties) {
+  auto searched = sygraph::tests::buildGraphFromMatrix<Space>(q, matrix, properties);
+  properties.edge_sources = true;
+  auto stored = sygraph::tests::buildGraphFromMatrix<Space>(q, matrix, properties);
+  assert(!searched.hasEdgeSources());
+  assert(stored.hasEdgeSources());
+
+  const size_t n_edges = stored.getEdgeCount();
+  auto sources = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::shared>(2 * n_edges, q);
+  auto searched_dev = searched.getDeviceGraph();
+  auto stored_dev = stored.getDeviceGraph();
+  q.parallel_for(sycl::range<1>{n_edges}, [=](sycl::id<1> edge) {
+    sources[edge] = searched_dev.getSourceVertex(edge[0]);
+    sources[n_edges + edge] = stored_dev.getSourceVertex(edge[0]);
+  });
+  q.wait();
+  for (size_t edge = 0; edge < n_edges; ++edge) { assert(sources[edge] == sources[n_edges + edge]); }
+  sygraph::memory::detail::releaseUSM(sources, q);
+
+  // the extra array is accounted on its own: one vertex index per edge
+  assert(searched.getMemoryFootprint().edge_source_bytes == 0);
+  assert(stored.getMemoryFootprint().edge_source_bytes == n_edges * sizeof(uint));
+  assert(stored.getMemoryFootprint().total() == searched.getMemoryFootprint().total() + n_edges * sizeof(uint));
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  // small work-groups make the fill span several of them
+  auto profile = sygraph::device::getProfile(q);
+  profile.compute_unit_size = 2;
+  sygraph::device::setProfile(q, profile);
+
+  sygraph::graph::Properties directed;
+  directed.directed = true;
+  directed.weighted = true;
+  checkEdgeSources<sygraph::memory::space::shared>(q, sygraph::tests::fixtures::star_5, {});
+  checkEdgeSources<sygraph::memory::space::shared>(q, sygraph::tests::fixtures::line_5, {});
+  checkEdgeSources<sygraph::memory::space::shared>(q, sygraph::tests::fixtures::weighted_directed_5, directed);
+  checkEdgeSources<sygraph::memory::space::device>(q, sygraph::tests::fixtures::weighted_directed_5, directed);
+
+  // the sources can also be stored after construction, and the host lookup uses them
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  graph.buildEdgeSources();
+  graph.buildEdgeSources();
+  assert(graph.getSourceVertex(0) == 0);
+  assert(graph.getSourceVertex(4) == 1);
+  assert(graph.getSourceVertex(7) == 4);
+}
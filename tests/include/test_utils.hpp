@@ -3,6 +3,7 @@
 #include <array>
 #include <cassert>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -44,15 +45,52 @@ inline constexpr std::string_view weighted_directed_5 = "5\n"
                                                         "0 0 0 0 1\n"
                                                         "0 0 0 0 0";
 
+/**
+ * @brief Builds the matrix of `n` vertices where `hub` is linked to every vertex, the first `clique` vertices form a
+ * clique, and a sparse deterministic pattern, `(i * j + i + j) % 5 == 0`, links the others.
+ *
+ * @param weight The weight of the edge from `i` to `j`, 1 when not given.
+ */
+inline std::string buildHubMatrix(size_t n, size_t hub = 0, size_t clique = 0, const std::function<size_t(size_t, size_t)>& weight = {}) {
+  std::string matrix = std::to_string(n) + "\n";
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      const bool linked = i != j && (i == hub || j == hub || (i < clique && j < clique) || (i * j + i + j) % 5 == 0);
+      matrix += linked ? std::to_string(weight ? weight(i, j) : 1) + " " : "0 ";
+    }
+    matrix += "\n";
+  }
+  return matrix;
+}
+
+/**
+ * @brief Builds the matrix of `count` cliques of `size` vertices, every one linked to the next by a single edge between
+ * their first vertices.
+ */
+inline std::string buildCliques(size_t count, size_t size) {
+  const size_t n = count * size;
+  std::string matrix = std::to_string(n) + "\n";
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      const size_t a = i / size;
+      const size_t b = j / size;
+      const bool bridge = i % size == 0 && j % size == 0 && a != b && ((a + 1) % count == b || (b + 1) % count == a);
+      matrix += (i != j && a == b) || bridge ? "1 " : "0 ";
+    }
+    matrix += "\n";
+  }
+  return matrix;
+}
+
 } // namespace fixtures
 
-inline sycl::queue makeQueue() {
+inline sycl::queue makeQueue(const sycl::property_list& properties = {}) {
   setenv("UR_ADAPTERS_FORCE_LOAD", "opencl", 0);
   try {
-    return sycl::queue{sycl::gpu_selector_v};
+    return sycl::queue{sycl::gpu_selector_v, properties};
   } catch (const sycl::exception&) {
     try {
-      return sycl::queue{sycl::default_selector_v};
+      return sycl::queue{sycl::default_selector_v, properties};
     } catch (const sycl::exception&) {
       std::cout << "Skipping test: no SYCL platform available" << std::endl;
       std::exit(0);
@@ -0,0 +1,89 @@
+#include "test_utils.hpp"
+
+template<sygraph::operators::direction Direction, sygraph::operators::load_balancer LoadBalancer, typename GraphT>
+std::vector<uint> run_case(GraphT& G, const std::vector<uint>& sources, std::vector<uint>& visits) {
+  using frontier_view_t = sygraph::frontier::frontier_view;
+  using frontier_impl_t = sygraph::frontier::frontier_type;
+
+  auto& q = G.getQueue();
+  auto in_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(q, G);
+  auto out_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(q, G);
+  auto counts = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(G.getVertexCount(), q);
+  for (size_t i = 0; i < G.getVertexCount(); ++i) { counts[i] = 0; }
+  for (auto source : sources) { in_frontier.insert(source); }
+
+  auto e = sygraph::operators::advance::frontier<Direction, LoadBalancer, frontier_view_t::vertex, frontier_view_t::vertex>(
+      G, in_frontier, out_frontier, [=](auto src, auto, auto, auto) -> bool {
+        sygraph::sync::atomicFetchAdd(counts + src, 1U);
+        return true;
+      });
+  e.waitAndThrow();
+
+  visits.assign(counts, counts + G.getVertexCount());
+  sygraph::memory::detail::releaseUSM(counts, q);
+  return sygraph::tests::activeElements(out_frontier);
+}
+
+int main() {
+  using load_balancer_t = sygraph::operators::load_balancer;
+  using direction_t = sygraph::operators::direction;
+  auto q = sygraph::tests::makeQueue();
+  auto G = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+
+  // the statistics are gathered while the offsets are built
+  auto frontier = sygraph::frontier::makeFrontier<sygraph::frontier::frontier_view::vertex, sygraph::frontier::frontier_type::mlb>(q, G);
+  frontier.insert(0);
+  frontier.insert(3);
+  frontier.computeActiveFrontier(false, G.getDeviceGraph()).wait();
+  sygraph::frontier::FrontierStats stats;
+  q.copy(frontier.getDeviceFrontier().getStats(), &stats, 1).wait();
+  assert(stats.active_elements == 2);
+  assert(stats.max_degree == 4);
+  assert(stats.degree_sum == 5);
+
+  frontier.computeActiveFrontier(true, G.getDeviceGraph()).wait();
+  q.copy(frontier.getDeviceFrontier().getStats(), &stats, 1).wait();
+  assert(stats.active_elements == 3);
+  assert(stats.max_degree == 1);
+  assert(stats.degree_sum == 3);
+
+  // thresholds default to the sub-group and work-group sizes of the device
+  const auto& profile = sygraph::device::getProfile(q);
+  sygraph::tuning::TuningProfile tuning;
+  stats.max_degree = profile.sub_group_size;
+  assert(sygraph::operators::advance::detail::automatic::select(stats, profile, tuning) == load_balancer_t::workitem_mapped);
+  stats.max_degree = static_cast<uint32_t>(profile.compute_unit_size);
+  assert(sygraph::operators::advance::detail::automatic::select(stats, profile, tuning) == load_balancer_t::bucketing);
+  tuning.workitem_max_degree = 1;
+  tuning.bucketing_min_degree = 8;
+  stats.max_degree = 4;
+  assert(sygraph::operators::advance::detail::automatic::select(stats, profile, tuning) == load_balancer_t::workgroup_mapped);
+
+  // every balancer, including the automatic one, visits the same edges
+  std::vector<uint> expected_visits;
+  std::vector<uint> visits;
+  auto expected = run_case<direction_t::push, load_balancer_t::workgroup_mapped>(G, {0, 3}, expected_visits);
+  sygraph::tests::expectEqual(expected, std::vector<uint>{0, 1, 2, 3, 4});
+  sygraph::tests::expectEqual(run_case<direction_t::push, load_balancer_t::workitem_mapped>(G, {0, 3}, visits), expected);
+  sygraph::tests::expectEqual(visits, expected_visits);
+  sygraph::tests::expectEqual(run_case<direction_t::push, load_balancer_t::automatic>(G, {0, 3}, visits), expected);
+  sygraph::tests::expectEqual(visits, expected_visits);
+
+  // the tuning profile steers the automatic choice
+  sygraph::tuning::setProfile(tuning);
+  sygraph::tests::expectEqual(run_case<direction_t::push, load_balancer_t::automatic>(G, {0}, visits), std::vector<uint>{1, 2, 3, 4});
+  sygraph::tests::expectEqual(visits, std::array<uint, 5>{4, 0, 0, 0, 0});
+  tuning.bucketing_min_degree = 2;
+  sygraph::tuning::setProfile(tuning);
+  sygraph::tests::expectEqual(run_case<direction_t::push, load_balancer_t::automatic>(G, {0}, visits), std::vector<uint>{1, 2, 3, 4});
+  sygraph::tests::expectEqual(visits, std::array<uint, 5>{4, 0, 0, 0, 0});
+  sygraph::tuning::resetProfile();
+
+  // pull advances collect the statistics of the unvisited vertices
+  expected = run_case<direction_t::pull, load_balancer_t::workgroup_mapped>(G, {0}, expected_visits);
+  sygraph::tests::expectEqual(expected, std::vector<uint>{1, 2, 3, 4});
+  sygraph::tests::expectEqual(run_case<direction_t::pull, load_balancer_t::workitem_mapped>(G, {0}, visits), expected);
+  sygraph::tests::expectEqual(visits, expected_visits);
+  sygraph::tests::expectEqual(run_case<direction_t::pull, load_balancer_t::automatic>(G, {0}, visits), expected);
+  sygraph::tests::expectEqual(visits, expected_visits);
+}
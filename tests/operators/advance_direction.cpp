@@ -0,0 +1,112 @@
+#include "test_utils.hpp"
+
+template<typename GraphT, typename OptimizerT>
+std::vector<uint> run_step(GraphT& G, OptimizerT& optimizer, const std::vector<uint>& sources, uint* distances, uint iter) {
+  using frontier_view_t = sygraph::frontier::frontier_view;
+  using frontier_impl_t = sygraph::frontier::frontier_type;
+
+  auto& q = G.getQueue();
+  auto in_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(q, G);
+  auto out_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(q, G);
+  for (auto source : sources) { in_frontier.insert(source); }
+
+  const uint unvisited = G.getVertexCount() + 1;
+  auto e = sygraph::operators::advance::frontier<sygraph::operators::direction::automatic,
+                                                 sygraph::operators::load_balancer::workgroup_mapped,
+                                                 frontier_view_t::vertex,
+                                                 frontier_view_t::vertex>(
+      G,
+      in_frontier,
+      out_frontier,
+      [=](auto src, auto dst, auto, auto) -> bool {
+        if (distances[dst] != unvisited) { return false; }
+        distances[dst] = iter + 1;
+        return true;
+      },
+      optimizer);
+  e.waitAndThrow();
+  return sygraph::tests::activeElements(out_frontier);
+}
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+  auto G = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  auto distances = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::shared>(G.getVertexCount(), q);
+  auto reset_distances = [&]() {
+    for (size_t i = 0; i < G.getVertexCount(); ++i) { distances[i] = G.getVertexCount() + 1; }
+    distances[0] = 0;
+  };
+
+  // a low alpha keeps the traversal in push, the unexplored edges shrink by the frontier degree
+  sygraph::operators::advance::DirectionOptimizer<> optimizer(G, 0.5f, 1.0f);
+  assert(optimizer.getUnexploredEdges() == G.getEdgeCount());
+  reset_distances();
+  sygraph::tests::expectEqual(run_step(G, optimizer, {0}, distances, 0), std::vector<uint>{1, 2, 3, 4});
+  assert(optimizer.isPush());
+  assert(optimizer.getUnexploredEdges() == G.getEdgeCount() - 4);
+
+  // a traversal that revisits the hub keeps every edge unexplored, so the second visit does not switch to pull
+  sygraph::operators::advance::DirectionOptimizer<sygraph::operators::direction::pull_all, sygraph::frontier::frontier_view::graph, true> revisiting(
+      G, 1.5f, 1.0f);
+  for (int step = 0; step < 2; step++) {
+    reset_distances();
+    sygraph::tests::expectEqual(run_step(G, revisiting, {0}, distances, 0), std::vector<uint>{1, 2, 3, 4});
+    assert(revisiting.isPush());
+    assert(revisiting.getUnexploredEdges() == G.getEdgeCount());
+  }
+
+  // a high alpha pulls the hub's neighbors, a small frontier brings the traversal back to push
+  optimizer.reset(100.0f, 1.0f);
+  reset_distances();
+  sygraph::tests::expectEqual(run_step(G, optimizer, {0}, distances, 0), std::vector<uint>{1, 2, 3, 4});
+  assert(!optimizer.isPush());
+  sygraph::tests::expectEqual(std::vector<uint>(distances, distances + G.getVertexCount()), std::array<uint, 5>{0, 1, 1, 1, 1});
+  sygraph::tests::expectEqual(run_step(G, optimizer, {1, 2, 3, 4}, distances, 1), std::vector<uint>{});
+  assert(optimizer.isPush());
+  assert(optimizer.getUnexploredEdges() == 0);
+  sygraph::memory::detail::releaseUSM(distances, q);
+
+  // algorithms reach the same results in the automatic direction, pulling on every step with high alpha and beta
+  sygraph::tuning::TuningProfile tuning;
+  tuning.bfs_alpha = 1000.0f;
+  tuning.bfs_beta = 1000.0f;
+  sygraph::tuning::setProfile(tuning);
+
+  sygraph::graph::Properties properties;
+  properties.directed = true;
+  properties.weighted = true;
+  auto weighted = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  sygraph::algorithms::SSSP sssp(weighted);
+  sssp.setDirection(sygraph::operators::direction::automatic);
+  uint source = 0;
+  sssp.init(source);
+  sssp.run();
+  std::vector<uint> sssp_distances(weighted.getVertexCount());
+  for (size_t i = 0; i < sssp_distances.size(); ++i) { sssp_distances[i] = sssp.getDistance(i); }
+  sygraph::tests::expectEqual(sssp_distances, std::array<uint, 5>{0, 1, 3, 4, 5});
+
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  sygraph::algorithms::BFS bfs(line);
+  bfs.init(source);
+  auto details = bfs.run(sygraph::algorithms::bfs_direction::hybrid);
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+  assert(details.push_steps.empty());
+  assert(details.pull_steps.size() == 5);
+
+  sygraph::algorithms::CC cc(line);
+  cc.setDirection(sygraph::operators::direction::automatic);
+  cc.init(source);
+  cc.run();
+
+  sygraph::algorithms::BC bc(line);
+  bc.setDirection(sygraph::operators::direction::automatic);
+  bc.init(source);
+  bc.run();
+
+  bool thrown = false;
+  try {
+    sssp.setDirection(sygraph::operators::direction::pull);
+  } catch (const std::runtime_error&) { thrown = true; }
+  assert(thrown);
+  sygraph::tuning::resetProfile();
+}
@@ -0,0 +1,59 @@
+#include "test_utils.hpp"
+
+int main() {
+  using frontier_view_t = sygraph::frontier::frontier_view;
+  using frontier_type_t = sygraph::frontier::frontier_type;
+  using load_balancer_t = sygraph::operators::load_balancer;
+
+  auto q = sygraph::tests::makeQueue();
+  // edges in CSR order: 0->1, 1->0, 1->2, 2->1, 2->3, 3->2, 3->4, 4->3
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+
+  auto edges = sygraph::frontier::makeFrontier<frontier_view_t::edge, frontier_type_t::mlb>(q, graph);
+  auto out_edges = sygraph::frontier::makeFrontier<frontier_view_t::edge, frontier_type_t::mlb>(q, graph);
+  auto vertices = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_type_t::mlb>(q, graph);
+  auto sources = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(graph.getEdgeCount(), q);
+  q.fill(sources, UINT32_MAX, graph.getEdgeCount()).wait();
+
+  // edge frontier to vertex frontier: the destinations of the accepted edges
+  edges.insert(2);
+  edges.insert(6);
+  auto e = sygraph::operators::advance::frontier<load_balancer_t::workgroup_mapped, frontier_view_t::edge, frontier_view_t::vertex>(
+      graph, edges, vertices, [=](auto src, auto, auto edge, auto) -> bool {
+        sources[edge] = src;
+        return true;
+      });
+  e.waitAndThrow();
+  sygraph::tests::expectFrontier(vertices, std::vector<uint>{2, 4});
+  assert(sources[2] == 1 && sources[6] == 3);
+  assert(sources[0] == UINT32_MAX);
+
+  // vertex frontier to edge frontier: the edges leaving the frontier
+  vertices.clear();
+  vertices.insert(1);
+  e = sygraph::operators::advance::frontier<load_balancer_t::bucketing, frontier_view_t::vertex, frontier_view_t::edge>(
+      graph, vertices, out_edges, [](auto, auto, auto, auto) -> bool { return true; });
+  e.waitAndThrow();
+  sygraph::tests::expectFrontier(out_edges, std::vector<uint>{1, 2});
+
+  // edge frontier to edge frontier: keep the edges pointing to a larger vertex
+  edges.clear();
+  out_edges.clear();
+  for (uint edge = 0; edge < graph.getEdgeCount(); ++edge) { edges.insert(edge); }
+  e = sygraph::operators::advance::frontier<load_balancer_t::automatic, frontier_view_t::edge, frontier_view_t::edge>(
+      graph, edges, out_edges, [](auto src, auto dst, auto, auto) -> bool { return src < dst; });
+  e.waitAndThrow();
+  sygraph::tests::expectFrontier(out_edges, std::vector<uint>{0, 2, 4, 6});
+
+  // filter and compute run on the edge indices
+  auto filtered = sygraph::operators::filter::external(graph, edges, out_edges, [](auto edge) { return edge >= 5; });
+  filtered.waitAndThrow();
+  sygraph::tests::expectFrontier(out_edges, std::vector<uint>{5, 6, 7});
+
+  auto marked = sygraph::operators::compute::execute<frontier_view_t::edge>(graph, out_edges, [=](auto edge) { sources[edge] = 0; });
+  marked.waitAndThrow();
+  assert(sources[5] == 0 && sources[6] == 0 && sources[7] == 0);
+  assert(sources[4] == UINT32_MAX);
+
+  sygraph::memory::detail::releaseUSM(sources, q);
+}
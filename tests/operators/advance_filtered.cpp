@@ -0,0 +1,63 @@
+#include "test_utils.hpp"
+#include <array>
+#include <sycl/sycl.hpp>
+#include <sygraph/sygraph.hpp>
+
+template<sygraph::operators::direction Direction, sygraph::operators::load_balancer LoadBalancer, typename GraphT>
+std::vector<bool> run_filtered_case(GraphT& G, uint32_t source, uint32_t* accepted_edges) {
+  using frontier_view_t = sygraph::frontier::frontier_view;
+  using frontier_impl_t = sygraph::frontier::frontier_type;
+
+  auto& q = G.getQueue();
+  auto in_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(q, G);
+  auto out_frontier = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_impl_t::mlb>(q, G);
+  in_frontier.insert(source);
+  accepted_edges[0] = 0;
+
+  auto e = sygraph::operators::advance::frontier_filtered<Direction, LoadBalancer, frontier_view_t::vertex, frontier_view_t::vertex>(
+      G,
+      in_frontier,
+      out_frontier,
+      [=](auto, auto, auto, auto) -> bool {
+        sygraph::sync::atomicFetchAdd(accepted_edges, 1U);
+        return true;
+      },
+      [=](auto vertex) -> bool { return vertex % 2 == 0; });
+  e.waitAndThrow();
+
+  std::vector<bool> active(G.getVertexCount());
+  for (size_t i = 0; i < active.size(); ++i) { active[i] = out_frontier.check(i); }
+  return active;
+}
+
+int main() {
+  using direction_t = sygraph::operators::direction;
+  using load_balancer_t = sygraph::operators::load_balancer;
+
+  auto q = sygraph::tests::makeQueue();
+  auto G = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  auto accepted_edges = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(1, q);
+
+  // pushing from the center, only the even leaves survive the filter although every edge is accepted
+  const std::vector<bool> even_leaves{false, false, true, false, true};
+  assert((run_filtered_case<direction_t::push, load_balancer_t::workitem_mapped>(G, 0, accepted_edges) == even_leaves));
+  assert(accepted_edges[0] == 4);
+  assert((run_filtered_case<direction_t::push, load_balancer_t::workgroup_mapped>(G, 0, accepted_edges) == even_leaves));
+  assert(accepted_edges[0] == 4);
+  assert((run_filtered_case<direction_t::push, load_balancer_t::bucketing>(G, 0, accepted_edges) == even_leaves));
+  assert(accepted_edges[0] == 4);
+  assert((run_filtered_case<direction_t::push, load_balancer_t::automatic>(G, 0, accepted_edges) == even_leaves));
+  assert(accepted_edges[0] == 4);
+
+  // pulling into the leaves outside the frontier, the filter sees the pulling vertex
+  assert((run_filtered_case<direction_t::pull_all, load_balancer_t::workgroup_mapped>(G, 0, accepted_edges) == even_leaves));
+  assert(accepted_edges[0] == 4);
+
+  // a leaf pushing into the even center keeps it
+  const std::vector<bool> center{true, false, false, false, false};
+  assert((run_filtered_case<direction_t::push, load_balancer_t::workgroup_mapped>(G, 1, accepted_edges) == center));
+  assert(accepted_edges[0] == 1);
+  assert((run_filtered_case<direction_t::pull, load_balancer_t::bucketing>(G, 0, accepted_edges) == even_leaves));
+
+  sygraph::memory::detail::releaseUSM(accepted_edges, q);
+}
@@ -37,5 +37,57 @@ int main() {
   reduce.waitAndThrow();
   assert(sum == 6);
 
+  // the operator is honored, and the accumulator takes part in the result
+  uint32_t product = 1;
+  uint32_t minimum = 3;
+  auto multiplies = sygraph::operators::compute::reduce<frontier_view_t::vertex, sycl::multiplies<uint32_t>>(
+      graph, output, product, [=](auto vertex, auto& acc) { acc.combine(static_cast<uint32_t>(vertex) + 1); });
+  multiplies.waitAndThrow();
+  assert(product == 15);
+  auto min_reduce = sygraph::operators::compute::reduce<frontier_view_t::vertex, sycl::minimum<uint32_t>>(
+      graph, output, minimum, [=](auto vertex, auto& acc) { acc.combine(static_cast<uint32_t>(vertex) + 1); });
+  min_reduce.waitAndThrow();
+  assert(minimum == 1);
+
+  // several statistics in one pass, with the vertices of lowest and highest degree
+  using arg_t = sygraph::operators::compute::ArgValue<uint32_t>;
+  auto graph_dev = graph.getDeviceGraph();
+  uint32_t count = 0;
+  uint32_t max_vertex = 0;
+  arg_t lowest = sygraph::operators::compute::argmin<uint32_t>::identity();
+  arg_t highest = sygraph::operators::compute::argmax<uint32_t>::identity();
+  auto multi = sygraph::operators::compute::reduce<frontier_view_t::vertex,
+                                                   sycl::plus<uint32_t>,
+                                                   sycl::maximum<uint32_t>,
+                                                   sygraph::operators::compute::argmin<uint32_t>,
+                                                   sygraph::operators::compute::argmax<uint32_t>>(
+      graph, output, std::tie(count, max_vertex, lowest, highest), [=](auto vertex, auto& n, auto& max, auto& min_degree, auto& max_degree) {
+        const auto degree = static_cast<uint32_t>(graph_dev.getDegree(vertex));
+        n += 1;
+        max.combine(static_cast<uint32_t>(vertex));
+        min_degree.combine(arg_t{degree, static_cast<uint32_t>(vertex)});
+        max_degree.combine(arg_t{degree, static_cast<uint32_t>(vertex)});
+      });
+  multi.waitAndThrow();
+  assert(count == 3);
+  assert(max_vertex == 4);
+  assert((lowest == arg_t{1, 2}));
+  assert((highest == arg_t{4, 0}));
+
+  // results kept in device memory
+  auto device_stats = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::device>(2, q);
+  const uint32_t initial_stats[2] = {0, 0};
+  q.copy(initial_stats, device_stats, 2).wait();
+  auto on_device = sygraph::operators::compute::reduce<frontier_view_t::vertex, sycl::plus<uint32_t>, sycl::maximum<uint32_t>>(
+      graph, output, std::make_tuple(device_stats, device_stats + 1), [=](auto vertex, auto& total, auto& max) {
+        total += static_cast<uint32_t>(vertex);
+        max.combine(static_cast<uint32_t>(vertex));
+      });
+  on_device.waitAndThrow();
+  uint32_t host_stats[2];
+  q.copy(device_stats, host_stats, 2).wait();
+  assert(host_stats[0] == 6 && host_stats[1] == 4);
+  sygraph::memory::detail::releaseUSM(device_stats, q);
+
   sygraph::memory::detail::releaseUSM(seen, q);
 }
@@ -1,5 +1,23 @@
 #include "test_utils.hpp"
 
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+template<typename GraphT>
+void checkEdgeIntersections(sycl::queue& q, GraphT& graph, const std::vector<uint>& expected) {
+  const size_t n_edges = graph.getEdgeCount();
+  auto counts = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(n_edges, q);
+  q.fill(counts, 0U, n_edges).wait();
+  auto e = sygraph::operators::intersection::edges(graph, [=](auto, auto, auto edge, auto) { sygraph::sync::atomicFetchAdd(counts + edge, 1U); });
+  e.waitAndThrow();
+  for (size_t edge = 0; edge < n_edges; ++edge) { assert(counts[edge] == expected[edge]); }
+  sygraph::memory::detail::releaseUSM(counts, q);
+}
+
+} // namespace
+
 int main() {
   using frontier_view_t = sygraph::frontier::frontier_view;
   using frontier_type_t = sygraph::frontier::frontier_type;
@@ -18,4 +36,103 @@ int main() {
   event.waitAndThrow();
 
   sygraph::tests::expectFrontier(out, std::vector<uint>{1, 3});
+
+  // device intersections of adjacency lists, checked against the host for every strategy
+  const size_t n = 40;
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(n));
+  std::vector<uint> expected(dense.getEdgeCount());
+  const auto* offsets = dense.getRowOffsets();
+  const auto* columns = dense.getColumnIndices();
+  for (size_t u = 0; u < n; ++u) {
+    for (auto edge = offsets[u]; edge < offsets[u + 1]; ++edge) {
+      const auto v = columns[edge];
+      std::vector<uint> common;
+      std::set_intersection(
+          columns + offsets[u], columns + offsets[u + 1], columns + offsets[v], columns + offsets[v + 1], std::back_inserter(common));
+      expected[edge] = common.size();
+    }
+  }
+
+  sygraph::tuning::TuningProfile merge_only;
+  merge_only.intersection_gallop_ratio = n;
+  merge_only.intersection_hash_min_degree = n;
+  sygraph::tuning::TuningProfile gallop_only;
+  gallop_only.intersection_gallop_ratio = 1;
+  gallop_only.intersection_hash_min_degree = n;
+  sygraph::tuning::TuningProfile hash_only;
+  hash_only.intersection_hash_min_degree = 1;
+  for (const auto& tuning : {sygraph::tuning::TuningProfile{}, merge_only, gallop_only, hash_only}) {
+    sygraph::tuning::setProfile(tuning);
+    checkEdgeIntersections(q, dense, expected);
+  }
+  sygraph::tuning::setProfile(sygraph::tuning::TuningProfile{});
+
+  // the default hash window is never empty, and pairs of a clique whose degree opens it are hashed by a work-group
+  namespace intersection_detail = sygraph::operators::intersection::detail;
+  const auto& device_profile = sygraph::device::getProfile(q);
+  const auto settings = intersection_detail::makeIntersectionSettings<uint>(device_profile, sygraph::tuning::TuningProfile{});
+  assert(settings.hash_min_degree < settings.hash_max_degree);
+  const size_t k = settings.hash_min_degree + 1;
+  assert(intersection_detail::selectStrategy(k - 1, k - 1, settings) == intersection_detail::strategy::hash);
+  auto clique = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildCliques(1, k));
+  auto clique_sources = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::shared>(2, q);
+  auto clique_destinations = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::shared>(2, q);
+  auto clique_counts = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(2, q);
+  clique_sources[0] = 0;
+  clique_destinations[0] = k - 1;
+  clique_sources[1] = 1;
+  clique_destinations[1] = 1;
+  clique_counts[0] = clique_counts[1] = 0;
+  sygraph::operators::intersection::pairs(clique, clique_sources, clique_destinations, 2, [=](auto, auto, auto index, auto) {
+    sygraph::sync::atomicFetchAdd(clique_counts + index, 1U);
+  }).waitAndThrow();
+  assert(clique_counts[0] == k - 2);
+  assert(clique_counts[1] == k - 1);
+  sygraph::memory::detail::releaseUSM(clique_sources, q);
+  sygraph::memory::detail::releaseUSM(clique_destinations, q);
+  sygraph::memory::detail::releaseUSM(clique_counts, q);
+
+  sygraph::tuning::TuningProfile oversized;
+  oversized.intersection_hash_min_degree = settings.hash_max_degree;
+  bool thrown = false;
+  try {
+    intersection_detail::makeIntersectionSettings<uint>(device_profile, oversized);
+  } catch (const std::runtime_error&) { thrown = true; }
+  assert(thrown);
+
+  // a batch of pairs, adjacent or not, and only the edges that pass the filter
+  auto pair_sources = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::shared>(3, q);
+  auto pair_destinations = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::shared>(3, q);
+  auto pair_counts = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(3, q);
+  const uint sources_host[3] = {0, 1, 2};
+  const uint destinations_host[3] = {4, 3, 2};
+  for (size_t i = 0; i < 3; ++i) {
+    pair_sources[i] = sources_host[i];
+    pair_destinations[i] = destinations_host[i];
+    pair_counts[i] = 0;
+  }
+  auto e = sygraph::operators::intersection::pairs(
+      graph, pair_sources, pair_destinations, 3, [=](auto, auto, auto index, auto) { sygraph::sync::atomicFetchAdd(pair_counts + index, 1U); });
+  e.waitAndThrow();
+  assert(pair_counts[0] == 0); // N(0) = {1}, N(4) = {3}
+  assert(pair_counts[1] == 1); // N(1) = {0, 2}, N(3) = {2, 4}
+  assert(pair_counts[2] == 2); // N(2) with itself
+
+  auto filtered_counts = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(1, q);
+  filtered_counts[0] = 0;
+  e = sygraph::operators::intersection::edges(
+      dense, [=](auto, auto, auto, auto) { sygraph::sync::atomicFetchAdd(filtered_counts, 1U); }, [](auto u, auto v) { return u < v; });
+  e.waitAndThrow();
+  size_t expected_filtered = 0;
+  for (size_t u = 0; u < n; ++u) {
+    for (auto edge = offsets[u]; edge < offsets[u + 1]; ++edge) {
+      if (u < columns[edge]) { expected_filtered += expected[edge]; }
+    }
+  }
+  assert(filtered_counts[0] == expected_filtered);
+
+  sygraph::memory::detail::releaseUSM(pair_sources, q);
+  sygraph::memory::detail::releaseUSM(pair_destinations, q);
+  sygraph::memory::detail::releaseUSM(pair_counts, q);
+  sygraph::memory::detail::releaseUSM(filtered_counts, q);
 }
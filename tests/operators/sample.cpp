@@ -0,0 +1,118 @@
+#include "test_utils.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+namespace {
+
+template<typename T>
+std::vector<T> toHost(sycl::queue& q, const T* data, size_t size) {
+  std::vector<T> host(size);
+  q.copy(data, host.data(), size).wait();
+  return host;
+}
+
+template<sygraph::operators::sample::bias Bias, typename GraphT>
+auto draw(sycl::queue& q, GraphT& graph, const std::vector<uint>& seeds, const std::vector<size_t>& fanouts, uint64_t seed) {
+  auto seeds_dev = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::device>(seeds.size(), q);
+  q.copy(seeds.data(), seeds_dev, seeds.size()).wait();
+  auto sample = sygraph::operators::sample::neighbors<Bias>(graph, seeds_dev, seeds.size(), fanouts, seed);
+  sygraph::memory::detail::releaseUSM(seeds_dev, q);
+  return sample;
+}
+
+// checks that every hop draws min(degree, fanout) distinct edges of every vertex first reached at the previous hop
+template<typename GraphT, typename SampleT>
+void checkSample(sycl::queue& q, GraphT& graph, const SampleT& sample, const std::vector<size_t>& fanouts) {
+  const auto* offsets = graph.getRowOffsets();
+  const auto* columns = graph.getColumnIndices();
+  const auto sources = toHost(q, sample.getSources(), sample.getEdgeCount());
+  const auto destinations = toHost(q, sample.getDestinations(), sample.getEdgeCount());
+  const auto edges = toHost(q, sample.getEdges(), sample.getEdgeCount());
+  const auto vertices = toHost(q, sample.getVertices(), sample.getVertexCount());
+  const auto& hops = sample.getHopOffsets();
+  const auto& layers = sample.getLayerOffsets();
+  assert(hops.size() == fanouts.size() + 1);
+  assert(layers.size() == fanouts.size() + 2);
+  assert(std::set<uint>(vertices.begin(), vertices.end()).size() == vertices.size());
+
+  for (size_t hop = 0; hop < fanouts.size(); ++hop) {
+    size_t e = hops[hop];
+    std::set<uint> reached;
+    for (size_t i = layers[hop]; i < layers[hop + 1]; ++i) {
+      const uint u = vertices[i];
+      const size_t expected = std::min<size_t>(offsets[u + 1] - offsets[u], fanouts[hop]);
+      std::set<uint> drawn;
+      for (size_t k = 0; k < expected; ++k, ++e) {
+        assert(sources[e] == u);
+        assert(edges[e] >= offsets[u] && edges[e] < offsets[u + 1]);
+        assert(columns[edges[e]] == destinations[e]);
+        drawn.insert(edges[e]);
+        reached.insert(destinations[e]);
+      }
+      assert(drawn.size() == expected);
+    }
+    assert(e == hops[hop + 1]);
+    // the next layer holds, in increasing order, the reached vertices of no earlier layer
+    std::vector<uint> next(vertices.begin() + layers[hop + 1], vertices.begin() + layers[hop + 2]);
+    assert(std::is_sorted(next.begin(), next.end()));
+    for (uint v : next) { assert(reached.count(v) == 1); }
+    for (uint v : reached) { assert(std::find(vertices.begin(), vertices.begin() + layers[hop + 2], v) != vertices.begin() + layers[hop + 2]); }
+  }
+}
+
+} // namespace
+
+int main() {
+  using bias_t = sygraph::operators::sample::bias;
+  auto q = sygraph::tests::makeQueue();
+
+  // a star: two leaves of the hub, then the hub again from both, which is already in the subgraph
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5);
+  auto star_sample = draw<bias_t::uniform>(q, star, {0}, {2, 3}, 7);
+  checkSample(q, star, star_sample, {2, 3});
+  sygraph::tests::expectEqual(star_sample.getLayerOffsets(), std::vector<size_t>{0, 1, 3, 3});
+  sygraph::tests::expectEqual(star_sample.getHopOffsets(), std::vector<size_t>{0, 2, 4});
+
+  // a neighborhood smaller than the fanout is taken whole
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  auto line_sample = draw<bias_t::uniform>(q, line, {2}, {5}, 1);
+  sygraph::tests::expectEqual(toHost(q, line_sample.getDestinations(), line_sample.getEdgeCount()), std::vector<uint>{1, 3});
+  sygraph::tests::expectEqual(toHost(q, line_sample.getVertices(), line_sample.getVertexCount()), std::vector<uint>{2, 1, 3});
+
+  // multiple hops over a graph with a hub and a heavy edge from the hub to vertex 1, the same sample for the same seed
+  sygraph::graph::Properties properties;
+  properties.weighted = true;
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(40, 0, 0, [](size_t i, size_t j) { return i == 0 && j == 1 ? 1000 : 1; }), properties);
+  const std::vector<size_t> fanouts{3, 2, 2};
+  auto first = draw<bias_t::uniform>(q, graph, {5, 0, 12}, fanouts, 42);
+  auto second = draw<bias_t::uniform>(q, graph, {5, 0, 12}, fanouts, 42);
+  checkSample(q, graph, first, fanouts);
+  sygraph::tests::expectEqual(toHost(q, first.getEdges(), first.getEdgeCount()), toHost(q, second.getEdges(), second.getEdgeCount()));
+  checkSample(q, graph, draw<bias_t::weighted>(q, graph, {5, 0, 12}, fanouts, 42), fanouts);
+
+  // the merged lists of the hub give its edges with the largest keys, in decreasing order of key
+  auto hub_sample = draw<bias_t::uniform>(q, graph, {0}, {5}, 42);
+  std::vector<uint> hub_edges(graph.getRowOffsets()[1] - graph.getRowOffsets()[0]);
+  std::iota(hub_edges.begin(), hub_edges.end(), graph.getRowOffsets()[0]);
+  std::sort(hub_edges.begin(), hub_edges.end(), [](uint a, uint b) {
+    const float key_a = sygraph::random::uniform(42, 0, a);
+    const float key_b = sygraph::random::uniform(42, 0, b);
+    return key_a > key_b || (key_a == key_b && a < b);
+  });
+  hub_edges.resize(5);
+  sygraph::tests::expectEqual(toHost(q, hub_sample.getEdges(), hub_sample.getEdgeCount()), hub_edges);
+
+  // the heavy edge of the hub is drawn far more often than any of its 38 light edges
+  size_t heavy = 0;
+  size_t uniform_heavy = 0;
+  for (uint64_t seed = 0; seed < 64; ++seed) {
+    auto weighted = draw<bias_t::weighted>(q, graph, {0}, {1}, seed);
+    heavy += toHost(q, weighted.getDestinations(), 1)[0] == 1 ? 1 : 0;
+    auto uniform = draw<bias_t::uniform>(q, graph, {0}, {1}, seed);
+    uniform_heavy += toHost(q, uniform.getDestinations(), 1)[0] == 1 ? 1 : 0;
+  }
+  assert(heavy >= 48);
+  assert(uniform_heavy <= 16);
+}
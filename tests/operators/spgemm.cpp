@@ -0,0 +1,123 @@
+#include "test_utils.hpp"
+
+#include <algorithm>
+
+namespace {
+
+template<typename GraphT>
+std::vector<uint> toDense(const GraphT& graph) {
+  const size_t n = graph.getVertexCount();
+  std::vector<uint> dense(n * n, 0);
+  const auto* offsets = graph.getRowOffsets();
+  for (size_t u = 0; u < n; ++u) {
+    for (auto e = offsets[u]; e < offsets[u + 1]; ++e) { dense[(u * n) + graph.getColumnIndices()[e]] = graph.getValues()[e]; }
+  }
+  return dense;
+}
+
+// checks the product against the dense product computed on the host, and that every row is sorted
+template<typename ProductT, typename GraphT>
+void checkProduct(const ProductT& product, const GraphT& a, const GraphT& b, const std::type_identity_t<GraphT>* mask) {
+  const size_t n = a.getVertexCount();
+  const auto dense_a = toDense(a);
+  const auto dense_b = toDense(b);
+  const auto dense_mask = mask != nullptr ? toDense(*mask) : std::vector<uint>(n * n, 1);
+  const auto* offsets = product.getRowOffsets();
+  const auto* columns = product.getColumnIndices();
+  size_t nnz = 0;
+  for (size_t u = 0; u < n; ++u) {
+    for (auto e = offsets[u]; e < offsets[u + 1]; ++e) { assert(e == offsets[u] || columns[e - 1] < columns[e]); }
+    for (size_t v = 0; v < n; ++v) {
+      bool reached = false;
+      uint value = 0;
+      for (size_t k = 0; k < n; ++k) {
+        if (dense_a[(u * n) + k] != 0 && dense_b[(k * n) + v] != 0) {
+          reached = true;
+          value += dense_a[(u * n) + k] * dense_b[(k * n) + v];
+        }
+      }
+      if (!reached || dense_mask[(u * n) + v] == 0) { continue; }
+      auto* it = std::find(columns + offsets[u], columns + offsets[u + 1], v);
+      assert(it != columns + offsets[u + 1]);
+      assert(product.getValues()[it - columns] == value);
+      nnz++;
+    }
+  }
+  assert(product.getEdgeCount() == nnz);
+}
+
+// checks that the inverse graph holds the transposed edges, with their weights, sorted within every row
+template<typename GraphT>
+void checkInverse(GraphT& graph) {
+  const size_t n = graph.getVertexCount();
+  auto& inverse = graph.getInverseDeviceGraph();
+  assert(inverse.getEdgeCount() == graph.getEdgeCount());
+  const auto dense = toDense(graph);
+  const auto* offsets = inverse.getRowOffsets();
+  for (size_t v = 0; v < n; ++v) {
+    for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+      const auto u = inverse.getColumnIndices()[e];
+      assert(e == offsets[v] || inverse.getColumnIndices()[e - 1] < u);
+      assert(dense[(u * n) + v] == inverse.getValues()[e]);
+    }
+  }
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  // the device scan spans several blocks and runs in place
+  const size_t count = (3 * sygraph::device::getProfile(q).compute_unit_size) + 5;
+  auto scanned = sygraph::memory::detail::memoryAlloc<uint, sygraph::memory::space::shared>(count + 1, q);
+  for (size_t i = 0; i < count; ++i) { scanned[i] = static_cast<uint>(i % 7); }
+  sygraph::scan::exclusiveSum(q, scanned, scanned, count).waitAndThrow();
+  uint sum = 0;
+  for (size_t i = 0; i <= count; ++i) {
+    assert(scanned[i] == sum);
+    sum += static_cast<uint>(i % 7);
+  }
+  sygraph::memory::detail::releaseUSM(scanned, q);
+
+  // masked by itself, the square of an undirected graph counts the triangles of every edge
+  auto triangle = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::triangle_3);
+  auto support = sygraph::operators::spgemm::multiply(triangle, triangle, triangle);
+  assert(support.getEdgeCount() == 6);
+  assert(!support.getProperties().directed);
+  for (size_t e = 0; e < support.getEdgeCount(); ++e) { assert(support.getValues()[e] == 1); }
+
+  // the 2-hop paths of a line reach the vertex itself and the one two steps away
+  auto line = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  auto paths = sygraph::operators::spgemm::multiply(line, line);
+  sygraph::tests::expectEqual(std::vector<uint>(paths.getRowOffsets(), paths.getRowOffsets() + 6), std::vector<uint>{0, 2, 4, 7, 9, 11});
+  assert(!paths.getProperties().directed);
+  checkProduct(paths, line, line, nullptr);
+
+  // a product checked against the host, with and without a mask, with weights growing with the endpoints
+  sygraph::graph::Properties properties;
+  properties.weighted = true;
+  auto dense = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::buildHubMatrix(40, 0, 0, [](size_t i, size_t j) { return 1 + ((i + j) % 3); }), properties);
+  auto square = sygraph::operators::spgemm::multiply(dense, dense);
+  checkProduct(square, dense, dense, nullptr);
+  auto masked = sygraph::operators::spgemm::multiply(dense, dense, dense);
+  checkProduct(masked, dense, dense, &dense);
+
+  // tables too large for the slot budget are built a few rows at a time, after a symbolic pass
+  namespace spgemm_detail = sygraph::operators::spgemm::detail;
+  auto batched = spgemm_detail::launchMultiply<sygraph::operators::spmv::plus_times<uint>>(
+      dense, dense, spgemm_detail::NoMask{dense.getVertexCount()}, sygraph::graph::Properties{true, true}, 64);
+  checkProduct(batched, dense, dense, nullptr);
+  checkInverse(batched);
+
+  // the tropical semiring gives the cheapest 2-hop paths of a directed graph
+  properties.directed = true;
+  auto weighted = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  auto cheapest = sygraph::operators::spgemm::multiply<sygraph::operators::spmv::min_plus<uint>>(weighted, weighted);
+  sygraph::tests::expectEqual(std::vector<uint>(cheapest.getColumnIndices(), cheapest.getColumnIndices() + cheapest.getEdgeCount()),
+                              std::vector<uint>{2, 3, 4, 3, 4, 4});
+  sygraph::tests::expectEqual(std::vector<uint>(cheapest.getValues(), cheapest.getValues() + cheapest.getEdgeCount()),
+                              std::vector<uint>{3, 5, 9, 3, 7, 2});
+  assert(cheapest.getProperties().directed);
+  checkInverse(cheapest);
+}
@@ -0,0 +1,106 @@
+#include "test_utils.hpp"
+
+#include <cmath>
+
+namespace {
+
+using aggregator_t = sygraph::operators::spmm::aggregator;
+
+// the aggregation computed on the host from the CSR arrays
+template<aggregator_t Agg>
+std::vector<float> expectedAggregate(const std::vector<uint>& offsets,
+                                     const std::vector<uint>& columns,
+                                     const std::vector<uint>& weights,
+                                     const std::vector<float>& features,
+                                     size_t num_features,
+                                     const sygraph::operators::spmm::AggregationSettings& settings) {
+  const size_t n = offsets.size() - 1;
+  std::vector<float> result(n * num_features, 0.0f);
+  for (size_t u = 0; u < n; ++u) {
+    const uint degree = offsets[u + 1] - offsets[u];
+    for (size_t c = 0; c < num_features; ++c) {
+      float acc = Agg == aggregator_t::max ? std::numeric_limits<float>::lowest() : 0.0f;
+      for (uint e = offsets[u]; e < offsets[u + 1]; ++e) {
+        const uint v = columns[e];
+        float value = features[(v * num_features) + c];
+        if (settings.edge_weights) { value *= static_cast<float>(weights[e]); }
+        if (settings.norm == sygraph::operators::spmm::normalization::symmetric) {
+          value /= std::sqrt(static_cast<float>(degree) * static_cast<float>(offsets[v + 1] - offsets[v]));
+        }
+        acc = Agg == aggregator_t::max ? std::max(acc, value) : acc + value;
+      }
+      if (Agg == aggregator_t::mean && degree > 0) { acc /= static_cast<float>(degree); }
+      if (Agg == aggregator_t::max && degree == 0) { acc = 0.0f; }
+      result[(u * num_features) + c] = acc;
+    }
+  }
+  return result;
+}
+
+template<aggregator_t Agg, typename GraphT>
+void checkAggregate(sycl::queue& q, GraphT& graph, size_t num_features, const sygraph::operators::spmm::AggregationSettings& settings) {
+  const size_t n = graph.getVertexCount();
+  std::vector<uint> offsets(graph.getRowOffsets(), graph.getRowOffsets() + n + 1);
+  std::vector<uint> columns(graph.getColumnIndices(), graph.getColumnIndices() + graph.getEdgeCount());
+  std::vector<uint> weights(graph.getValues(), graph.getValues() + graph.getEdgeCount());
+
+  std::vector<float> features(n * num_features);
+  for (size_t i = 0; i < features.size(); ++i) { features[i] = static_cast<float>((i * 7) % 11) - 3.0f; }
+  auto features_dev = sygraph::memory::detail::memoryAlloc<float, sygraph::memory::space::device>(features.size(), q);
+  auto output_dev = sygraph::memory::detail::memoryAlloc<float, sygraph::memory::space::device>(features.size(), q);
+  q.copy(features.data(), features_dev, features.size()).wait();
+
+  sygraph::operators::spmm::aggregate<Agg>(graph, features_dev, output_dev, num_features, settings).waitAndThrow();
+  std::vector<float> output(features.size());
+  q.copy(output_dev, output.data(), output.size()).wait();
+
+  auto expected = expectedAggregate<Agg>(offsets, columns, weights, features, num_features, settings);
+  for (size_t i = 0; i < output.size(); ++i) { assert(std::abs(output[i] - expected[i]) < 1e-4f); }
+
+  sygraph::memory::detail::releaseUSM(features_dev, q);
+  sygraph::memory::detail::releaseUSM(output_dev, q);
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  sygraph::graph::Properties properties;
+  properties.weighted = true;
+  auto star = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::star_5, properties);
+  properties.directed = true;
+  auto weighted = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+
+  // narrow matrices pack several rows in a work-group, wide ones span several column tiles
+  const size_t wide = sygraph::device::getProfile(q).compute_unit_size + 3;
+  for (size_t num_features : {size_t{3}, size_t{64}, wide}) {
+    sygraph::operators::spmm::AggregationSettings settings;
+    checkAggregate<aggregator_t::sum>(q, star, num_features, settings);
+    checkAggregate<aggregator_t::mean>(q, weighted, num_features, settings);
+    checkAggregate<aggregator_t::max>(q, weighted, num_features, settings);
+
+    settings.norm = sygraph::operators::spmm::normalization::symmetric;
+    checkAggregate<aggregator_t::sum>(q, star, num_features, settings);
+
+    settings.norm = sygraph::operators::spmm::normalization::none;
+    settings.edge_weights = true;
+    checkAggregate<aggregator_t::sum>(q, weighted, num_features, settings);
+    checkAggregate<aggregator_t::max>(q, weighted, num_features, settings);
+  }
+
+  // the in-neighbors of a directed graph: vertex 3 is reached from 1 (weight 6) and 2 (weight 1)
+  std::vector<float> features{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+  auto features_dev = sygraph::memory::detail::memoryAlloc<float, sygraph::memory::space::shared>(5, q);
+  auto output_dev = sygraph::memory::detail::memoryAlloc<float, sygraph::memory::space::shared>(5, q);
+  for (size_t i = 0; i < 5; ++i) { features_dev[i] = features[i]; }
+  sygraph::operators::spmm::AggregationSettings incoming;
+  incoming.edge_weights = true;
+  incoming.incoming = true;
+  sygraph::operators::spmm::aggregate(weighted, features_dev, output_dev, 1, incoming).waitAndThrow();
+  assert(output_dev[0] == 0.0f);
+  assert(output_dev[3] == 15.0f);
+  assert(output_dev[4] == 19.0f);
+  sygraph::memory::detail::releaseUSM(features_dev, q);
+  sygraph::memory::detail::releaseUSM(output_dev, q);
+}
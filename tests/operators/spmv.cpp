@@ -0,0 +1,82 @@
+#include "test_utils.hpp"
+
+#include <limits>
+
+namespace {
+
+using direction_t = sygraph::operators::direction;
+using frontier_view_t = sygraph::frontier::frontier_view;
+using frontier_type_t = sygraph::frontier::frontier_type;
+
+constexpr uint32_t inf = std::numeric_limits<uint32_t>::max();
+
+template<direction_t Direction, typename GraphT>
+void checkProducts(sycl::queue& q, GraphT& graph) {
+  namespace spmv = sygraph::operators::spmv;
+  const size_t n = graph.getVertexCount();
+  auto x = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(n, q);
+  auto y = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(n, q);
+  auto read = [&]() { return std::vector<uint32_t>(y, y + n); };
+
+  // one relaxation of the distances from vertex 0
+  q.fill(x, inf, n).wait();
+  x[0] = 0;
+  spmv::vxm<spmv::min_plus<uint32_t>, Direction>(graph, x, y).waitAndThrow();
+  sygraph::tests::expectEqual(read(), std::vector<uint32_t>{inf, 1, 4, inf, inf});
+
+  // the same from a sparse input holding vertex 0 only
+  auto pattern = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_type_t::mlb>(q, graph);
+  pattern.insert(0);
+  q.fill(x, 7U, n).wait();
+  x[0] = 0;
+  spmv::vxm<spmv::min_plus<uint32_t>, Direction>(graph, pattern, x, y).waitAndThrow();
+  sygraph::tests::expectEqual(read(), std::vector<uint32_t>{inf, 1, 4, inf, inf});
+
+  // reachability in one step, without writing the vertices of the mask
+  auto mask = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_type_t::mlb>(q, graph);
+  mask.insert(1);
+  q.fill(y, 9U, n).wait();
+  x[0] = 1;
+  spmv::vxm<spmv::or_and<uint32_t>, Direction>(graph, pattern, x, y, mask, true).waitAndThrow();
+  sygraph::tests::expectEqual(read(), std::vector<uint32_t>{0, 9, 1, 0, 0});
+
+  // the weight leaving every vertex, and only for the vertices of the mask
+  q.fill(x, 1U, n).wait();
+  spmv::mxv<spmv::plus_times<uint32_t>, Direction>(graph, x, y).waitAndThrow();
+  sygraph::tests::expectEqual(read(), std::vector<uint32_t>{5, 8, 6, 1, 0});
+  q.fill(y, 9U, n).wait();
+  spmv::mxv<spmv::plus_times<uint32_t>, Direction>(graph, x, y, mask).waitAndThrow();
+  sygraph::tests::expectEqual(read(), std::vector<uint32_t>{9, 8, 9, 9, 9});
+
+  // the scaled weight of the edges entering vertex 3, from a sparse input
+  auto target = sygraph::frontier::makeFrontier<frontier_view_t::vertex, frontier_type_t::mlb>(q, graph);
+  target.insert(3);
+  x[3] = 2;
+  spmv::mxv<spmv::max_times<uint32_t>, Direction>(graph, target, x, y).waitAndThrow();
+  sygraph::tests::expectEqual(read(), std::vector<uint32_t>{0, 12, 2, 0, 0});
+
+  sygraph::memory::detail::releaseUSM(x, q);
+  sygraph::memory::detail::releaseUSM(y, q);
+}
+
+} // namespace
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  sygraph::graph::Properties properties;
+  properties.directed = true;
+  properties.weighted = true;
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+
+  checkProducts<direction_t::push>(q, graph);
+  checkProducts<direction_t::pull>(q, graph);
+  checkProducts<direction_t::automatic>(q, graph);
+
+  // the automatic direction with a threshold that always pushes
+  sygraph::tuning::TuningProfile push_only;
+  push_only.spmv_pull_density = 2.0f;
+  sygraph::tuning::setProfile(push_only);
+  checkProducts<direction_t::automatic>(q, graph);
+  sygraph::tuning::resetProfile();
+}
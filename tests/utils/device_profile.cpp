@@ -0,0 +1,36 @@
+#include "test_utils.hpp"
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  const auto& profile = sygraph::device::getProfile(q);
+  const uint32_t compute_units = profile.num_compute_units;
+  assert(compute_units > 0);
+  assert(profile.sub_group_size > 0);
+  assert(!profile.sub_group_sizes.empty());
+  assert(profile.max_work_group_size > 0);
+  assert(profile.bitmap_width == 32 || profile.bitmap_width == 64);
+  // cached: every call returns the same profile
+  assert(&sygraph::device::getProfile(q) == &profile);
+
+  // overridden values drive later launches
+  auto tuned = profile;
+  tuned.num_compute_units = 1;
+  sygraph::device::setProfile(q, tuned);
+  assert(sygraph::device::getProfile(q).num_compute_units == 1);
+  assert(sygraph::detail::device::getNumComputeUnits(q) == 1);
+
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  sygraph::algorithms::BFS bfs(graph);
+  uint source = 0;
+  bfs.init(source);
+  bfs.run();
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+
+  // profiles are replaced, never modified: references taken before an override or a reset stay valid
+  const auto& overridden = sygraph::device::getProfile(q);
+  sygraph::device::resetProfile(q);
+  assert(overridden.num_compute_units == 1);
+  assert(profile.num_compute_units == compute_units);
+  assert(sygraph::device::getProfile(q).num_compute_units == sygraph::device::queryProfile(q.get_device()).num_compute_units);
+}
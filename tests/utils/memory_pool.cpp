@@ -0,0 +1,75 @@
+#include "test_utils.hpp"
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+  auto& pool = sygraph::memory::getPool(q);
+  pool.trim();
+
+  auto* first = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::device>(100, q);
+  assert(first != nullptr);
+  sygraph::memory::detail::releaseUSM(first, q);
+  assert(first == nullptr);
+  assert(pool.getStats().cached_bytes > 0);
+
+  // same size class and memory space: the cached block is handed back
+  auto misses = pool.getStats().misses;
+  auto* second = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::device>(90, q);
+  assert(pool.getStats().misses == misses);
+
+  // different memory space: never served by a device block
+  auto* shared = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::shared>(100, q);
+  assert(pool.getStats().misses == misses + 1);
+  for (size_t i = 0; i < 100; i++) { shared[i] = static_cast<uint32_t>(i); }
+  assert(shared[99] == 99);
+
+  // copies of the queue share the pool
+  sycl::queue copy = q;
+  assert(&sygraph::memory::getPool(copy) == &pool);
+
+  // stream-ordered release
+  auto e = q.fill(second, 0u, 90);
+  sygraph::memory::detail::releaseUSM(second, q, e);
+  sygraph::memory::detail::releaseUSM(shared, q);
+  e.wait();
+  assert(pool.getStats().live_bytes == 0);
+
+  sygraph::memory::trim(q);
+  assert(pool.getStats().cached_bytes == 0);
+
+  // a disabled pool returns memory straight to the runtime
+  auto settings = pool.getSettings();
+  settings.enabled = false;
+  pool.setSettings(settings);
+  auto* uncached = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::host>(10, q);
+  sygraph::memory::detail::releaseUSM(uncached, q);
+  assert(pool.getStats().cached_bytes == 0);
+  settings.enabled = true;
+  pool.setSettings(settings);
+
+  // a block released with a pending event is not handed out before the event completes
+  {
+    auto* block = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::device>(100, q);
+    auto fill = q.fill(block, 1u, 100);
+    sygraph::memory::detail::releaseUSM(block, q, fill);
+    auto* next = sygraph::memory::detail::memoryAlloc<uint32_t, sygraph::memory::space::device>(100, q);
+    assert(next != block || fill.get_info<sycl::info::event::command_execution_status>() == sycl::info::event_command_status::complete);
+    sygraph::memory::detail::releaseUSM(next, q);
+    q.wait();
+  }
+
+  // memory used by the library is recycled between runs
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  {
+    auto frontier = sygraph::frontier::makeFrontier<sygraph::frontier::frontier_view::vertex, sygraph::frontier::frontier_type::mlb>(q, graph);
+  }
+  misses = pool.getStats().misses;
+  {
+    auto frontier = sygraph::frontier::makeFrontier<sygraph::frontier::frontier_view::vertex, sygraph::frontier::frontier_type::mlb>(q, graph);
+  }
+  assert(pool.getStats().misses == misses);
+
+  // erasing the pool drops the cached memory and the registry entry
+  sygraph::memory::erasePool(q);
+  assert(sygraph::memory::getPool(q).getStats().cached_bytes == 0);
+  assert(sygraph::memory::getPool(q).getStats().hits == 0);
+}
@@ -0,0 +1,95 @@
+#include "test_utils.hpp"
+
+#include <filesystem>
+
+int main() {
+  auto q = sygraph::tests::makeQueue();
+
+  // JSON round trip through a file
+  sygraph::tuning::TuningProfile tuned;
+  tuned.device = "test device";
+  tuned.load_balancer = sygraph::operators::load_balancer::bucketing;
+  tuned.compute_unit_size = 64;
+  tuned.bitmap_width = 64;
+  tuned.bfs_alpha = 15.0f;
+  tuned.bfs_beta = 24.0f;
+  tuned.convergence_period = 8;
+  tuned.command_graph = true;
+  tuned.intersection_gallop_ratio = 4;
+  tuned.intersection_hash_min_degree = 128;
+  tuned.spmv_pull_density = 0.25f;
+  const std::string path = (std::filesystem::temp_directory_path() / "sygraph-tuning-test.json").string();
+  sygraph::tuning::save(tuned, path);
+  auto loaded = sygraph::tuning::load(path);
+  std::filesystem::remove(path);
+  assert(loaded.device == tuned.device);
+  assert(loaded.load_balancer == tuned.load_balancer);
+  assert(loaded.compute_unit_size == 64);
+  assert(loaded.bitmap_width == 64);
+  assert(loaded.bfs_alpha == 15.0f);
+  assert(loaded.bfs_beta == 24.0f);
+  assert(loaded.convergence_period == 8);
+  assert(loaded.command_graph);
+  assert(loaded.intersection_gallop_ratio == 4);
+  assert(loaded.intersection_hash_min_degree == 128);
+  assert(loaded.spmv_pull_density == 0.25f);
+
+  // missing keys keep their defaults, malformed profiles are rejected
+  auto partial = sygraph::tuning::fromJSON(R"({"bfs_beta": 2.5})");
+  assert(partial.load_balancer == sygraph::operators::load_balancer::workgroup_mapped);
+  assert(partial.bfs_beta == 2.5f);
+  for (const char* invalid : {R"({"load_balancer": "none"})", R"({"bitmap_width": 16})", R"({"command_graph": 1})", R"({"bfs_alpha": })", "[]"}) {
+    bool thrown = false;
+    try {
+      sygraph::tuning::fromJSON(invalid);
+    } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown);
+  }
+
+  // a profile tuned on another device keeps the launch shapes of this one
+  const auto queried = sygraph::device::queryProfile(q.get_device());
+  sygraph::tuning::setProfile(loaded);
+  sygraph::device::resetProfile(q);
+  assert(sygraph::device::getProfile(q).compute_unit_size == queried.compute_unit_size);
+  assert(sygraph::device::getProfile(q).bitmap_width == queried.bitmap_width);
+
+  // the active profile drives the device profile and the algorithms
+  loaded.device = q.get_device().get_info<sycl::info::device::name>();
+  sygraph::tuning::setProfile(loaded);
+  assert(sygraph::tuning::getProfile().device == loaded.device);
+  sygraph::device::resetProfile(q);
+  assert(sygraph::device::getProfile(q).compute_unit_size == 64);
+  assert(sygraph::device::getProfile(q).bitmap_width == 64);
+
+  auto graph = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::line_5);
+  sygraph::algorithms::BFS bfs(graph);
+  uint source = 0;
+  bfs.init(source);
+  bfs.run(sygraph::algorithms::bfs_direction::hybrid);
+  sygraph::tests::expectEqual(bfs.getDistances(), std::array<uint, 5>{0, 1, 2, 3, 4});
+
+  sygraph::algorithms::BC bc(graph);
+  bc.init(source);
+  bc.run();
+
+  sygraph::graph::Properties properties;
+  properties.directed = true;
+  properties.weighted = true;
+  auto weighted = sygraph::tests::buildGraphFromMatrix(q, sygraph::tests::fixtures::weighted_directed_5, properties);
+  sygraph::algorithms::SSSP sssp(weighted);
+  sssp.init(source);
+  sssp.run();
+  std::vector<uint> distances(weighted.getVertexCount());
+  for (size_t i = 0; i < distances.size(); ++i) { distances[i] = sssp.getDistance(i); }
+  sygraph::tests::expectEqual(distances, std::array<uint, 5>{0, 1, 3, 4, 5});
+
+  // an explicit policy takes precedence over the profile
+  sygraph::algorithms::CC cc(graph);
+  cc.setLoadBalancer(sygraph::operators::load_balancer::workgroup_mapped);
+  cc.init(source);
+  cc.run();
+
+  sygraph::tuning::resetProfile();
+  sygraph::device::resetProfile(q);
+  assert(sygraph::device::getProfile(q).bitmap_width == sygraph::device::queryProfile(q.get_device()).bitmap_width);
+}